@@ -0,0 +1,122 @@
+#include <arba/strn/string32.hpp>
+#include <arba/strn/string56.hpp>
+#include <arba/strn/string64.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Time the length and mutation operations of the string-N classes on random-length inputs, where a branchy
+// implementation mispredicts.
+
+namespace
+{
+
+constexpr std::size_t input_count = std::size_t(1) << 20;
+constexpr int repeat_count = 10;
+
+// Random tokens of 1 to 8 characters.
+std::vector<std::string> make_tokens(std::mt19937_64& engine)
+{
+    std::uniform_int_distribution<std::size_t> length_distribution(1, 8);
+    std::uniform_int_distribution<int> char_distribution('A', 'Z');
+    std::vector<std::string> tokens(input_count);
+    for (std::string& token : tokens)
+    {
+        token.resize(length_distribution(engine));
+        for (char& ch : token)
+            ch = static_cast<char>(char_distribution(engine));
+    }
+    return tokens;
+}
+
+template <class Function>
+void run(std::string_view type_name, std::string_view operation, Function&& function)
+{
+    uint64_t sink = 0;
+    double best_ns = 0;
+    for (int repeat = 0; repeat < repeat_count; ++repeat)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        sink += function();
+        const std::chrono::duration<double, std::nano> duration = std::chrono::steady_clock::now() - start;
+        const double ns = duration.count() / double(input_count);
+        best_ns = repeat == 0 ? ns : std::min(best_ns, ns);
+    }
+    std::cout << std::left << std::setw(10) << type_name << std::setw(28) << operation << std::right << std::fixed
+              << std::setprecision(2) << std::setw(8) << best_ns << " ns/op   (" << (sink & 0xff) << ")" << std::endl;
+}
+
+template <class StringN>
+void benchmark(std::string_view type_name, const std::vector<std::string>& tokens, std::mt19937_64& engine)
+{
+    std::vector<StringN> strs;
+    strs.reserve(tokens.size());
+    for (const std::string& token : tokens)
+        strs.push_back(StringN(std::string_view(token)));
+    std::uniform_int_distribution<std::size_t> length_distribution(0, StringN::max_length());
+    std::vector<std::size_t> lengths(tokens.size());
+    for (std::size_t& length : lengths)
+        length = length_distribution(engine);
+
+    run(type_name, "length()", [&] {
+        uint64_t total = 0;
+        for (const StringN& str : strs)
+            total += str.length();
+        return total;
+    });
+    run(type_name, "push_back() per character", [&] {
+        uint64_t total = 0;
+        for (const std::string& token : tokens)
+        {
+            StringN str;
+            for (char ch : token)
+                str.push_back(ch);
+            total += str.integer();
+        }
+        return total;
+    });
+    run(type_name, "pop_back()", [&] {
+        uint64_t total = 0;
+        for (StringN str : strs)
+        {
+            str.pop_back();
+            total += str.integer();
+        }
+        return total;
+    });
+    run(type_name, "resize(random length)", [&] {
+        uint64_t total = 0;
+        for (std::size_t i = 0; i < strs.size(); ++i)
+        {
+            StringN str = strs[i];
+            str.resize(lengths[i], '_');
+            total += str.integer();
+        }
+        return total;
+    });
+    run(type_name, "operator+", [&] {
+        uint64_t total = 0;
+        for (std::size_t i = 1; i < strs.size(); ++i)
+            total += (strs[i - 1] + strs[i]).integer();
+        return total;
+    });
+}
+
+} // namespace
+
+int main()
+{
+    std::mt19937_64 engine(42);
+    const std::vector<std::string> tokens = make_tokens(engine);
+    benchmark<strn::string32>("string32", tokens, engine);
+    benchmark<strn::string56>("string56", tokens, engine);
+    benchmark<strn::string64>("string64", tokens, engine);
+    return EXIT_SUCCESS;
+}
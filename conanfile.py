@@ -26,11 +26,17 @@ class ArbaStrnRecipe(ConanFile):
     options = {
         "shared": [True, False],
         "fPIC": [True, False],
+        "header_only": [True, False],
+        "lto": [True, False],
+        "stats": [True, False],
         "test": [True, False]
     }
     default_options = {
         "shared": True,
         "fPIC": True,
+        "header_only": False,
+        "lto": False,
+        "stats": False,
         "test": False
     }
 
@@ -39,7 +45,7 @@ class ArbaStrnRecipe(ConanFile):
     no_copy_source = True
 
     # Sources
-    exports_sources = "LICENSE.md", "CMakeLists.txt", "test/*", "include/*", "src/*", "external/*", "cmake/*"
+    exports_sources = "LICENSE.md", "CMakeLists.txt", "test/*", "include/*", "src/*", "tool/*", "external/*", "cmake/*"
 
     # Other
     implements = ["auto_shared_fpic"]
@@ -49,6 +55,19 @@ class ArbaStrnRecipe(ConanFile):
         version_regex = r"""set_project_semantic_version\( *"?([0-9]+\.[0-9]+\.[0-9]+).*"""
         self.version = re.search(version_regex, cmakelist_content).group(1)
 
+    def configure(self):
+        if self.options.header_only:
+            self.package_type = "header-library"
+            self.options.rm_safe("shared")
+            self.options.rm_safe("fPIC")
+            self.options.rm_safe("lto")
+        elif self.options.shared:
+            self.options.rm_safe("fPIC")
+
+    def package_id(self):
+        if self.info.options.header_only:
+            self.info.clear()
+
     def layout(self):
         cmake_layout(self)
 
@@ -66,7 +85,12 @@ class ArbaStrnRecipe(ConanFile):
         deps.generate()
         tc = CMakeToolchain(self)
         upper_name = f"{self.project_namespace}_{self.project_base_name}".upper()
-        tc.variables[f"{upper_name}_LIBRARY_TYPE"] = "SHARED" if self.options.shared else "STATIC"
+        if self.options.header_only:
+            tc.variables[f"{upper_name}_HEADER_ONLY"] = "ON"
+        else:
+            tc.variables[f"{upper_name}_LIBRARY_TYPE"] = "SHARED" if self.options.shared else "STATIC"
+            tc.variables[f"{upper_name}_LTO"] = "ON" if self.options.lto else "OFF"
+        tc.variables[f"{upper_name}_STATS"] = "ON" if self.options.stats else "OFF"
         if self.options.test:
             tc.variables[f"BUILD_{upper_name}_TESTS"] = "TRUE"
         tc.generate()
@@ -85,9 +109,22 @@ class ArbaStrnRecipe(ConanFile):
         rmdir(self, os.path.join(self.package_folder, "lib", "cmake"))
 
     def package_info(self):
+        upper_name = f"{self.project_namespace}_{self.project_base_name}".upper()
+        defines = [f"{upper_name}_STATS"] if self.options.stats else []
+        # group_by.hpp runs std::thread.
+        system_libs = ["pthread"] if self.settings.os in ["Linux", "FreeBSD"] else []
+        if self.options.header_only:
+            self.cpp_info.set_property("cmake_target_name", f"{self.project_namespace}::{self.project_base_name}-header-only")
+            self.cpp_info.bindirs = []
+            self.cpp_info.libdirs = []
+            self.cpp_info.defines = [f"{upper_name}_HEADER_ONLY"] + defines
+            self.cpp_info.system_libs = system_libs
+            return
         postfix = "" if self.options.shared else "-static"
         name = self.name + postfix
         self.cpp_info.set_property("cmake_target_name", name.replace('-', '::', 1))
         if self.settings.build_type == "Debug":
             name += "-d"
         self.cpp_info.libs = [name]
+        self.cpp_info.defines = defines
+        self.cpp_info.system_libs = system_libs
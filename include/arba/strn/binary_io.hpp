@@ -0,0 +1,203 @@
+#pragma once
+
+#include "config.hpp"
+#include "string_n_traits.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <span>
+
+inline namespace arba
+{
+namespace strn
+{
+
+/**
+ * @brief Portable byte form of a string-N value: its characters in order (plus the length byte for string56).
+ *
+ * This is the little-endian encoding of the integer() of a little-endian host, hence the name. The same bytes are
+ * produced on every host, and comparing them with memcmp gives the alphabetical order of the strings.
+ */
+template <string_n StringN>
+inline constexpr std::array<std::byte, sizeof(StringN)> to_le_bytes(const StringN& str)
+{
+    static_assert(std::endian::native == std::endian::little || std::endian::native == std::endian::big);
+    std::array<std::byte, sizeof(StringN)> bytes;
+    const auto value = str.integer();
+    for (std::size_t i = 0; i < sizeof(StringN); ++i)
+    {
+        const std::size_t shift = std::endian::native == std::endian::little ? i : sizeof(StringN) - 1 - i;
+        bytes[i] = static_cast<std::byte>(value >> (8 * shift));
+    }
+    return bytes;
+}
+
+/**
+ * @brief Read a string-N value from the bytes produced by to_le_bytes().
+ */
+template <string_n StringN>
+inline constexpr StringN from_le_bytes(std::span<const std::byte, sizeof(StringN)> bytes)
+{
+    typename StringN::uint value = 0;
+    for (std::size_t i = 0; i < sizeof(StringN); ++i)
+    {
+        const std::size_t shift = std::endian::native == std::endian::little ? i : sizeof(StringN) - 1 - i;
+        value |= static_cast<typename StringN::uint>(bytes[i]) << (8 * shift);
+    }
+    return StringN::from_integer(value);
+}
+
+/**
+ * @brief Canonical big-endian integer of a string-N value: its first character is the most significant byte.
+ *
+ * Unlike integer(), its value does not depend on the host, and the integer order is the alphabetical order.
+ * Its big-endian bytes are the to_le_bytes() bytes.
+ */
+template <string_n StringN>
+inline constexpr typename StringN::uint to_be_integer(const StringN& str)
+{
+    using uint = typename StringN::uint;
+    if constexpr (std::endian::native == std::endian::big)
+        return str.integer();
+    uint value = str.integer(), result = 0;
+    for (std::size_t i = 0; i < sizeof(uint); ++i, value >>= 8)
+        result = static_cast<uint>((result << 8) | (value & 0xff));
+    return result;
+}
+
+/**
+ * @brief Build a string-N value from its canonical big-endian integer (see to_be_integer()).
+ */
+template <string_n StringN>
+inline constexpr StringN from_be_integer(typename StringN::uint value)
+{
+    using uint = typename StringN::uint;
+    if constexpr (std::endian::native == std::endian::big)
+        return StringN::from_integer(value);
+    uint result = 0;
+    for (std::size_t i = 0; i < sizeof(uint); ++i, value >>= 8)
+        result = static_cast<uint>((result << 8) | (value & 0xff));
+    return StringN::from_integer(result);
+}
+
+class binary_io_
+{
+    template <string_n StringN>
+    friend std::ostream& write(std::ostream& stream, std::span<const StringN> strs);
+    template <string_n StringN>
+    friend std::istream& read_into(std::istream& stream, std::span<StringN> strs);
+    template <string_n StringN>
+    friend bool write(int fd, std::span<const StringN> strs);
+    template <string_n StringN>
+    friend std::size_t read_into(int fd, std::span<StringN> strs);
+
+    inline constexpr static std::size_t chunk_size_ = 512;
+
+    // Call function(bytes) with the to_le_bytes() form of consecutive chunks of strs.
+    template <string_n StringN, class Function>
+    static bool for_each_le_chunk_(std::span<const StringN> strs, Function&& function)
+    {
+        std::array<std::byte, chunk_size_ * sizeof(StringN)> buffer;
+        for (std::size_t first = 0; first < strs.size(); first += chunk_size_)
+        {
+            const std::size_t count = std::min(chunk_size_, strs.size() - first);
+            for (std::size_t i = 0; i < count; ++i)
+                std::ranges::copy(to_le_bytes(strs[first + i]), buffer.begin() + i * sizeof(StringN));
+            if (!function(std::span<const std::byte>(buffer.data(), count * sizeof(StringN))))
+                return false;
+        }
+        return true;
+    }
+
+    // Convert, in place, strs whose bytes are in the to_le_bytes() form.
+    template <string_n StringN>
+    static void from_le_in_place_(std::span<StringN> strs)
+    {
+        for (StringN& str : strs)
+        {
+            std::array<std::byte, sizeof(StringN)> bytes = std::bit_cast<std::array<std::byte, sizeof(StringN)>>(str);
+            str = from_le_bytes<StringN>(bytes);
+        }
+    }
+
+    static bool write_all_(int fd, const std::byte* data, std::size_t size);
+    static std::size_t read_all_(int fd, std::byte* data, std::size_t size);
+};
+
+/**
+ * @brief Write string-N values to a binary stream, in the to_le_bytes() form.
+ *
+ * On little-endian hosts this form is the memory representation, so the whole span is written at once.
+ */
+template <string_n StringN>
+std::ostream& write(std::ostream& stream, std::span<const StringN> strs)
+{
+    if constexpr (std::endian::native == std::endian::little)
+    {
+        stream.write(reinterpret_cast<const char*>(strs.data()), static_cast<std::streamsize>(strs.size_bytes()));
+    }
+    else
+    {
+        binary_io_::for_each_le_chunk_(strs, [&](std::span<const std::byte> bytes) {
+            return static_cast<bool>(
+                stream.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size())));
+        });
+    }
+    return stream;
+}
+
+/**
+ * @brief Read string-N values written by write() from a binary stream.
+ *
+ * On little-endian hosts the bytes are read directly into strs. If the stream ends before strs is full, the
+ * failbit is set and stream.gcount() / sizeof(StringN) values have been read.
+ */
+template <string_n StringN>
+std::istream& read_into(std::istream& stream, std::span<StringN> strs)
+{
+    stream.read(reinterpret_cast<char*>(strs.data()), static_cast<std::streamsize>(strs.size_bytes()));
+    if constexpr (std::endian::native == std::endian::big)
+        binary_io_::from_le_in_place_(strs.first(static_cast<std::size_t>(stream.gcount()) / sizeof(StringN)));
+    return stream;
+}
+
+/**
+ * @brief Write string-N values to a file descriptor, in the to_le_bytes() form.
+ * @return false if a write failed (errno is then set).
+ */
+template <string_n StringN>
+bool write(int fd, std::span<const StringN> strs)
+{
+    if constexpr (std::endian::native == std::endian::little)
+        return binary_io_::write_all_(fd, reinterpret_cast<const std::byte*>(strs.data()), strs.size_bytes());
+    else
+        return binary_io_::for_each_le_chunk_(strs, [&](std::span<const std::byte> bytes) {
+            return binary_io_::write_all_(fd, bytes.data(), bytes.size());
+        });
+}
+
+/**
+ * @brief Read string-N values written by write() from a file descriptor.
+ * @return The number of values read: less than strs.size() at the end of the file or on error (errno is then set).
+ */
+template <string_n StringN>
+std::size_t read_into(int fd, std::span<StringN> strs)
+{
+    const std::size_t count
+        = binary_io_::read_all_(fd, reinterpret_cast<std::byte*>(strs.data()), strs.size_bytes()) / sizeof(StringN);
+    if constexpr (std::endian::native == std::endian::big)
+        binary_io_::from_le_in_place_(strs.first(count));
+    return count;
+}
+
+} // namespace strn
+} // namespace arba
+
+#ifdef ARBA_STRN_HEADER_ONLY
+#include "impl/binary_io.hpp"
+#endif
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+inline namespace arba
+{
+namespace strn
+{
+
+/**
+ * @brief The bitmask class is a dynamic array of bits used to report per-key results of batch operations.
+ */
+class bitmask
+{
+public:
+    using word_type = uint64_t;
+    inline constexpr static std::size_t word_bits = sizeof(word_type) * 8;
+
+    bitmask() = default;
+    explicit bitmask(std::size_t size) { resize(size); }
+
+    /**
+     * @brief Resize the mask and reset every bit to zero.
+     * @param size The new number of bits.
+     */
+    inline void resize(std::size_t size)
+    {
+        size_ = size;
+        words_.assign((size + word_bits - 1) / word_bits, 0);
+    }
+
+    inline std::size_t size() const { return size_; }
+    inline bool empty() const { return size_ == 0; }
+    inline bool test(std::size_t index) const { return (words_[index / word_bits] >> (index % word_bits)) & 1; }
+    inline bool operator[](std::size_t index) const { return test(index); }
+
+    inline void set(std::size_t index, bool value = true)
+    {
+        word_type& word = words_[index / word_bits];
+        const word_type bit = word_type(1) << (index % word_bits);
+        word = (word & ~bit) | (-static_cast<word_type>(value) & bit);
+    }
+
+    inline void reset() { std::fill(words_.begin(), words_.end(), 0); }
+
+    /**
+     * @brief Count the bits set to one.
+     */
+    inline std::size_t count() const
+    {
+        std::size_t result = 0;
+        for (word_type word : words_)
+            result += std::popcount(word);
+        return result;
+    }
+
+    inline std::span<word_type> words() { return words_; }
+    inline std::span<const word_type> words() const { return words_; }
+
+private:
+    std::vector<word_type> words_;
+    std::size_t size_ = 0;
+};
+
+} // namespace strn
+} // namespace arba
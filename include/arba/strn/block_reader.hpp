@@ -0,0 +1,74 @@
+#pragma once
+
+#include "config.hpp"
+
+#include <cstddef>
+#include <filesystem>
+#include <span>
+
+inline namespace arba
+{
+namespace strn
+{
+
+/**
+ * @brief Options of a block_reader.
+ */
+struct block_reader_options
+{
+    /// Ask the operating system to read ahead aggressively (posix_fadvise(POSIX_FADV_SEQUENTIAL)).
+    bool sequential_hint = true;
+    /// Bypass the page cache (O_DIRECT), when the file system supports it. Reads must then be done in buffers
+    /// aligned on, and sized in multiples of, block_reader::direct_io_alignment bytes.
+    bool direct_io = false;
+};
+
+/**
+ * @brief The block_reader class reads a file descriptor sequentially, in large blocks.
+ */
+class block_reader
+{
+public:
+    inline constexpr static std::size_t direct_io_alignment = 4096;
+
+    /**
+     * @brief block_reader
+     * @param fd An open file descriptor, which is not closed by the reader. direct_io is ignored.
+     */
+    explicit block_reader(int fd, const block_reader_options& options = block_reader_options());
+
+    /**
+     * @brief block_reader
+     * @param path The file to open.
+     * @throw std::system_error If the file cannot be opened.
+     */
+    explicit block_reader(const std::filesystem::path& path,
+                          const block_reader_options& options = block_reader_options());
+    block_reader(const block_reader&) = delete;
+    block_reader& operator=(const block_reader&) = delete;
+    ~block_reader();
+
+    /**
+     * @brief Read the next bytes of the file, filling buffer unless the end of the file is reached.
+     * @return The number of bytes read, 0 at the end of the file.
+     * @throw std::system_error If a read fails.
+     */
+    std::size_t read(std::span<std::byte> buffer);
+
+    inline bool direct_io() const { return direct_io_; }
+
+private:
+    static void advise_sequential_(int fd);
+
+private:
+    int fd_ = -1;
+    bool owns_fd_ = false;
+    bool direct_io_ = false;
+};
+
+} // namespace strn
+} // namespace arba
+
+#ifdef ARBA_STRN_HEADER_ONLY
+#include "impl/block_reader.hpp"
+#endif
@@ -0,0 +1,243 @@
+#pragma once
+
+#include "bitmask.hpp"
+#include "hash_policy.hpp"
+#include "string_n_traits.hpp"
+
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <istream>
+#include <ostream>
+#include <span>
+#include <vector>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+inline namespace arba
+{
+namespace strn
+{
+
+/**
+ * @brief The bloom_filter class is a register-blocked Bloom filter whose keys are string-N values.
+ *
+ * Each key sets 4 bits in a single 256-bit block (one bit per 64-bit word), so a query touches one cache line and,
+ * with AVX2, is a single vector test. The block index and the 4 bit positions are all taken from one
+ * mum_mix() of integer(): no byte loop is ever run over the key.
+ *
+ * strn::bloom_filter<strn::string64> filter(1'000'000);
+ * filter.insert("AAPL"_s64);
+ * bool maybe = filter.may_contain("AAPL"_s64);
+ */
+template <string_n StringN>
+class bloom_filter
+{
+public:
+    using key_type = StringN;
+
+private:
+    inline constexpr static std::size_t block_words_ = 4;
+    inline constexpr static std::size_t block_bits_ = block_words_ * 64;
+    inline constexpr static char magic_[8] = { 's', 't', 'r', 'n', 'b', 'f', '0', '1' };
+    inline constexpr static uint64_t deserialize_chunk_ = 4096;
+
+    struct alignas(32) block_type_
+    {
+        std::array<uint64_t, block_words_> words;
+    };
+
+public:
+    /**
+     * @brief bloom_filter
+     * @param expected_keys The number of keys the filter is sized for.
+     * @param bits_per_key The number of filter bits per expected key (10 gives about 1% false positives).
+     */
+    explicit bloom_filter(std::size_t expected_keys = 0, std::size_t bits_per_key = 10)
+        : blocks_(std::max<std::size_t>(1, (expected_keys * bits_per_key + block_bits_ - 1) / block_bits_))
+    {
+    }
+
+    inline void insert(const key_type& key)
+    {
+        const uint64_t hash = mum_mix(key.integer());
+        block_type_& block = blocks_[block_index_(hash)];
+        for (std::size_t i = 0; i < block_words_; ++i)
+            block.words[i] |= bit_mask_(hash, i);
+    }
+
+    inline void insert(std::span<const key_type> keys)
+    {
+        for (const key_type& key : keys)
+            insert(key);
+    }
+
+    inline bool may_contain(const key_type& key) const
+    {
+        const uint64_t hash = mum_mix(key.integer());
+        return test_block_(blocks_[block_index_(hash)], hash);
+    }
+
+    /**
+     * @brief Query a batch of keys.
+     * @param keys The keys to test.
+     * @param result Resized to keys.size(): bit i is set if keys[i] may be in the filter.
+     *
+     * Keys are processed in groups of 64: all the blocks of a group are prefetched before any is tested, so that the
+     * cache misses of the group overlap.
+     */
+    void may_contain(std::span<const key_type> keys, bitmask& result) const
+    {
+        result.resize(keys.size());
+        std::span<bitmask::word_type> words = result.words();
+        for (std::size_t word_i = 0, first = 0; first < keys.size(); ++word_i, first += bitmask::word_bits)
+        {
+            const std::size_t count = std::min(bitmask::word_bits, keys.size() - first);
+            std::array<uint64_t, bitmask::word_bits> hashes;
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                hashes[i] = mum_mix(keys[first + i].integer());
+                prefetch_(hashes[i]);
+            }
+            bitmask::word_type word = 0;
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                const uint64_t hash = hashes[i];
+                word |= static_cast<bitmask::word_type>(test_block_(blocks_[block_index_(hash)], hash)) << i;
+            }
+            words[word_i] = word;
+        }
+    }
+
+    inline void clear() { std::fill(blocks_.begin(), blocks_.end(), block_type_{}); }
+    inline std::size_t block_count() const { return blocks_.size(); }
+    inline std::size_t size_in_bytes() const { return blocks_.size() * sizeof(block_type_); }
+
+    /**
+     * @brief Write the filter in a portable little-endian binary form.
+     */
+    std::ostream& serialize(std::ostream& stream) const
+    {
+        stream.write(magic_, sizeof(magic_));
+        write_u64_(stream, key_type::max_length());
+        write_u64_(stream, blocks_.size());
+        if constexpr (std::endian::native == std::endian::little)
+        {
+            stream.write(reinterpret_cast<const char*>(blocks_.data()),
+                         static_cast<std::streamsize>(size_in_bytes()));
+        }
+        else
+        {
+            for (const block_type_& block : blocks_)
+                for (uint64_t word : block.words)
+                    write_u64_(stream, word);
+        }
+        return stream;
+    }
+
+    /**
+     * @brief Read a filter written by serialize().
+     *
+     * On malformed input, the failbit of the stream is set and the filter is left unchanged.
+     */
+    std::istream& deserialize(std::istream& stream)
+    {
+        char magic[sizeof(magic_)];
+        uint64_t key_length = 0, block_count = 0;
+        if (!stream.read(magic, sizeof(magic)) || std::memcmp(magic, magic_, sizeof(magic_)) != 0
+            || !read_u64_(stream, key_length) || key_length != key_type::max_length()
+            || !read_u64_(stream, block_count) || block_count == 0 || block_count > blocks_.max_size())
+        {
+            stream.setstate(std::ios_base::failbit);
+            return stream;
+        }
+        // The blocks are read by chunks, so that a corrupted block count fails on the end of the stream rather than
+        // on allocating its blocks.
+        std::vector<block_type_> blocks;
+        for (uint64_t read_count = 0; read_count < block_count && stream;)
+        {
+            const auto chunk_size = static_cast<std::size_t>(std::min(block_count - read_count, deserialize_chunk_));
+            blocks.resize(blocks.size() + chunk_size);
+            const std::span<block_type_> chunk = std::span(blocks).last(chunk_size);
+            if constexpr (std::endian::native == std::endian::little)
+            {
+                stream.read(reinterpret_cast<char*>(chunk.data()),
+                            static_cast<std::streamsize>(chunk_size * sizeof(block_type_)));
+            }
+            else
+            {
+                for (block_type_& block : chunk)
+                    for (uint64_t& word : block.words)
+                        read_u64_(stream, word);
+            }
+            read_count += chunk_size;
+        }
+        if (stream)
+            blocks_ = std::move(blocks);
+        return stream;
+    }
+
+private:
+    inline std::size_t block_index_(uint64_t hash) const
+    {
+        // Multiply-high range reduction of the upper 32 bits: no modulo, any block count.
+        return static_cast<std::size_t>(((hash >> 32) * static_cast<uint64_t>(blocks_.size())) >> 32);
+    }
+
+    inline static uint64_t bit_mask_(uint64_t hash, std::size_t word_index)
+    {
+        return uint64_t(1) << ((hash >> (6 * word_index)) & 63);
+    }
+
+    inline static bool test_block_(const block_type_& block, uint64_t hash)
+    {
+#if defined(__AVX2__)
+        const __m256i block_v = _mm256_load_si256(reinterpret_cast<const __m256i*>(block.words.data()));
+        const __m256i shifts = _mm256_and_si256(_mm256_srlv_epi64(_mm256_set1_epi64x(static_cast<long long>(hash)),
+                                                                  _mm256_set_epi64x(18, 12, 6, 0)),
+                                                _mm256_set1_epi64x(63));
+        const __m256i mask = _mm256_sllv_epi64(_mm256_set1_epi64x(1), shifts);
+        return _mm256_testc_si256(block_v, mask);
+#else
+        uint64_t missing = 0;
+        for (std::size_t i = 0; i < block_words_; ++i)
+            missing |= bit_mask_(hash, i) & ~block.words[i];
+        return missing == 0;
+#endif
+    }
+
+    inline void prefetch_([[maybe_unused]] uint64_t hash) const
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        __builtin_prefetch(&blocks_[block_index_(hash)]);
+#endif
+    }
+
+    inline static void write_u64_(std::ostream& stream, uint64_t value)
+    {
+        char bytes[sizeof(value)];
+        for (std::size_t i = 0; i < sizeof(value); ++i)
+            bytes[i] = static_cast<char>(value >> (8 * i));
+        stream.write(bytes, sizeof(bytes));
+    }
+
+    inline static bool read_u64_(std::istream& stream, uint64_t& value)
+    {
+        unsigned char bytes[sizeof(value)];
+        if (!stream.read(reinterpret_cast<char*>(bytes), sizeof(bytes)))
+            return false;
+        value = 0;
+        for (std::size_t i = 0; i < sizeof(value); ++i)
+            value |= static_cast<uint64_t>(bytes[i]) << (8 * i);
+        return true;
+    }
+
+private:
+    std::vector<block_type_> blocks_;
+};
+
+} // namespace strn
+} // namespace arba
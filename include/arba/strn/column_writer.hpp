@@ -0,0 +1,192 @@
+#pragma once
+
+#include "string_n_traits.hpp"
+
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <ostream>
+#include <span>
+#include <string>
+#include <string_view>
+
+inline namespace arba
+{
+namespace strn
+{
+
+class column_writer_
+{
+    template <string_n StringN>
+    friend void write_csv_column(std::span<const StringN> strs, std::string& output);
+    template <string_n StringN>
+    friend void write_json_array(std::span<const StringN> strs, std::string& output);
+
+    inline constexpr static uint64_t ones_ = 0x0101010101010101ull;
+    inline constexpr static uint64_t highs_ = 0x8080808080808080ull;
+
+    // The characters of str, char i in bits [8*i, 8*i+8), the bytes after the length being zero.
+    template <string_n StringN>
+    inline static uint64_t chars_(const StringN& str)
+    {
+        uint64_t chars = 0;
+        if constexpr (std::endian::native == std::endian::little)
+            std::memcpy(&chars, &str[0], sizeof(StringN));
+        else
+            for (std::size_t i = 0; i < sizeof(StringN); ++i)
+                chars |= uint64_t(static_cast<uint8_t>(str[i])) << (8 * i);
+        if constexpr (StringN::max_length() < sizeof(StringN))
+            chars &= ~(uint64_t(0xff) << (8 * StringN::max_length()));
+        return chars;
+    }
+
+    // High bit set in every byte of chars equal to ch (exact: no false positive).
+    inline static uint64_t equal_bytes_(uint64_t chars, char ch)
+    {
+        const uint64_t diff = chars ^ (ones_ * static_cast<uint8_t>(ch));
+        return ~(((diff & ~highs_) + ~highs_) | diff) & highs_;
+    }
+
+    // High bit set in every byte of chars lower than 0x20, excluding the length padding bytes.
+    inline static uint64_t control_bytes_(uint64_t chars, std::size_t length)
+    {
+        const uint64_t lower = ~(((chars & ~highs_) + ones_ * (0x80 - 0x20)) | chars) & highs_;
+        return length < 8 ? lower & ((uint64_t(1) << (8 * length)) - 1) : lower;
+    }
+
+    inline static bool needs_escape_(uint64_t chars, std::size_t length, char quote, char special)
+    {
+        return (equal_bytes_(chars, quote) | equal_bytes_(chars, special) | control_bytes_(chars, length)) != 0;
+    }
+
+    template <string_n StringN>
+    inline static void append_chars_(std::string& output, const StringN& str, std::size_t length)
+    {
+        // Straight copy of the whole buffer, then drop the padding.
+        const std::size_t size = output.size();
+        output.resize(size + sizeof(StringN));
+        std::memcpy(output.data() + size, &str[0], sizeof(StringN));
+        output.resize(size + length);
+    }
+};
+
+/**
+ * @brief Append string-N values to a CSV column, one value per line.
+ *
+ * A value is quoted (with doubled inner quotes) only if it holds a comma, a double quote or a control character
+ * (line breaks included). The test is done on the 8 bytes at once (SWAR), and clean values, which are the vast
+ * majority, are appended with a single 8-byte copy.
+ */
+template <string_n StringN>
+void write_csv_column(std::span<const StringN> strs, std::string& output)
+{
+    output.reserve(output.size() + strs.size() * (StringN::max_length() + 1));
+    for (const StringN& str : strs)
+    {
+        const std::size_t length = str.length();
+        const uint64_t chars = column_writer_::chars_(str);
+        if (!column_writer_::needs_escape_(chars, length, '"', ','))
+        {
+            column_writer_::append_chars_(output, str, length);
+        }
+        else
+        {
+            output.push_back('"');
+            for (char ch : str.to_string_view())
+            {
+                if (ch == '"')
+                    output.push_back('"');
+                output.push_back(ch);
+            }
+            output.push_back('"');
+        }
+        output.push_back('\n');
+    }
+}
+
+/**
+ * @brief Append string-N values to a JSON array of strings.
+ *
+ * A value is escaped only if it holds a double quote, a backslash or a control character. The test is done on the
+ * 8 bytes at once (SWAR), and clean values, which are the vast majority, are appended with a single 8-byte copy.
+ */
+template <string_n StringN>
+void write_json_array(std::span<const StringN> strs, std::string& output)
+{
+    constexpr std::string_view hex_digits = "0123456789abcdef";
+    output.reserve(output.size() + strs.size() * (StringN::max_length() + 3) + 2);
+    output.push_back('[');
+    for (std::size_t i = 0; i < strs.size(); ++i)
+    {
+        if (i != 0)
+            output.push_back(',');
+        output.push_back('"');
+        const StringN& str = strs[i];
+        const std::size_t length = str.length();
+        const uint64_t chars = column_writer_::chars_(str);
+        if (!column_writer_::needs_escape_(chars, length, '"', '\\'))
+        {
+            column_writer_::append_chars_(output, str, length);
+        }
+        else
+        {
+            for (char ch : str.to_string_view())
+            {
+                switch (ch)
+                {
+                case '"':
+                    output.append("\\\"");
+                    break;
+                case '\\':
+                    output.append("\\\\");
+                    break;
+                case '\n':
+                    output.append("\\n");
+                    break;
+                case '\r':
+                    output.append("\\r");
+                    break;
+                case '\t':
+                    output.append("\\t");
+                    break;
+                default:
+                    if (static_cast<unsigned char>(ch) < 0x20)
+                    {
+                        output.append("\\u00");
+                        output.push_back(hex_digits[static_cast<unsigned char>(ch) >> 4]);
+                        output.push_back(hex_digits[ch & 0xf]);
+                    }
+                    else
+                        output.push_back(ch);
+                }
+            }
+        }
+        output.push_back('"');
+    }
+    output.push_back(']');
+}
+
+/**
+ * @brief Write string-N values to a stream as a CSV column (see write_csv_column(std::span, std::string&)).
+ */
+template <string_n StringN>
+std::ostream& write_csv_column(std::span<const StringN> strs, std::ostream& stream)
+{
+    std::string output;
+    write_csv_column(strs, output);
+    return stream.write(output.data(), static_cast<std::streamsize>(output.size()));
+}
+
+/**
+ * @brief Write string-N values to a stream as a JSON array (see write_json_array(std::span, std::string&)).
+ */
+template <string_n StringN>
+std::ostream& write_json_array(std::span<const StringN> strs, std::ostream& stream)
+{
+    std::string output;
+    write_json_array(strs, output);
+    return stream.write(output.data(), static_cast<std::streamsize>(output.size()));
+}
+
+} // namespace strn
+} // namespace arba
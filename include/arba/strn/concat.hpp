@@ -0,0 +1,45 @@
+#pragma once
+
+#include "string_n_cast.hpp"
+#include "string_n_traits.hpp"
+
+#include <optional>
+#include <type_traits>
+
+inline namespace arba
+{
+namespace strn
+{
+
+/**
+ * @brief Concatenate string-N values of any types into a StringN, each one appended with one shift and one or.
+ * @param strs The values to concatenate.
+ * @return A StringN, or a std::optional<StringN> with overflow_policy::optional.
+ *
+ * With overflow_policy::saturate, the result holds the values which fit entirely, up to the first one which does not.
+ *
+ * strn::string64 key = strn::concat<strn::string64>(venue, "."_s32, symbol);
+ * std::optional<strn::string32> code = strn::concat<strn::string32, strn::overflow_policy::optional>(a, b);
+ */
+template <string_n StringN, overflow_policy Policy = overflow_policy::truncate, string_n... Strs>
+inline constexpr auto concat(const Strs&... strs)
+    -> std::conditional_t<Policy == overflow_policy::optional, std::optional<StringN>, StringN>
+{
+    StringN result;
+    [[maybe_unused]] const auto append = [&result](const auto& str) {
+        bool truncated = false;
+        const StringN part = string_n_cast<StringN>(str, truncation_policy::truncate, truncated);
+        if (truncated && Policy != overflow_policy::truncate)
+            return false;
+        return result.append(part, Policy) && !truncated;
+    };
+    // Once a value does not fit, the next ones are not appended: the result is full with truncate.
+    [[maybe_unused]] const bool fits = (append(strs) && ...);
+    if constexpr (Policy == overflow_policy::optional)
+        return fits ? std::optional<StringN>(result) : std::nullopt;
+    else
+        return result;
+}
+
+} // namespace strn
+} // namespace arba
@@ -0,0 +1,11 @@
+#pragma once
+
+/**
+ * ARBA_STRN_HEADER_ONLY selects the header-only configuration (CMake option ARBA_STRN_HEADER_ONLY): the functions
+ * which are otherwise compiled in the library are then defined inline in the headers, from the impl/ directory.
+ */
+#ifdef ARBA_STRN_HEADER_ONLY
+#define ARBA_STRN_INLINE inline
+#else
+#define ARBA_STRN_INLINE
+#endif
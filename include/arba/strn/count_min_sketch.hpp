@@ -0,0 +1,115 @@
+#pragma once
+
+#include "hash_policy.hpp"
+#include "string_n_traits.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+inline namespace arba
+{
+namespace strn
+{
+
+/**
+ * @brief The count_min_sketch class estimates the number of occurrences of string-N keys in a stream, never below
+ * the true count.
+ *
+ * The counter of each row is chosen by double hashing the two halves of one mum_mix() of integer(): no byte loop is
+ * ever run over the key. With width w and depth d, an estimate exceeds the true count by more than 2.72 * N / w (N
+ * being the total count added) with probability at most exp(-d). Two sketches with the same dimensions merge into
+ * the sketch of both streams.
+ *
+ * strn::count_min_sketch<strn::string64> counts(1 << 16);
+ * counts.add(symbols);
+ * uint64_t aapl = counts.estimate("AAPL"_s64);
+ */
+template <string_n StringN>
+class count_min_sketch
+{
+public:
+    using key_type = StringN;
+
+    /**
+     * @brief count_min_sketch
+     * @param width The number of counters per row.
+     * @param depth The number of rows.
+     */
+    explicit count_min_sketch(std::size_t width = 1 << 16, std::size_t depth = 4)
+        : width_(std::max<std::size_t>(1, width)), depth_(std::max<std::size_t>(1, depth)),
+          counters_(width_ * depth_, 0)
+    {
+    }
+
+    inline std::size_t width() const { return width_; }
+    inline std::size_t depth() const { return depth_; }
+    inline uint64_t total_count() const { return total_count_; }
+
+    inline void add(const key_type& key, uint64_t count = 1)
+    {
+        const uint64_t hash = mum_mix(key.integer());
+        uint64_t* row = counters_.data();
+        for (std::size_t i = 0; i < depth_; ++i, row += width_)
+            row[column_(hash, i)] += count;
+        total_count_ += count;
+    }
+
+    inline void add(std::span<const key_type> keys)
+    {
+        for (const key_type& key : keys)
+            add(key);
+    }
+
+    inline uint64_t estimate(const key_type& key) const
+    {
+        const uint64_t hash = mum_mix(key.integer());
+        const uint64_t* row = counters_.data();
+        uint64_t count = std::numeric_limits<uint64_t>::max();
+        for (std::size_t i = 0; i < depth_; ++i, row += width_)
+            count = std::min(count, row[column_(hash, i)]);
+        return count;
+    }
+
+    /**
+     * @brief Add the counts of another sketch.
+     * @throw std::invalid_argument If the sketches have different dimensions.
+     */
+    void merge(const count_min_sketch& other)
+    {
+        if (other.width_ != width_ || other.depth_ != depth_)
+            throw std::invalid_argument("strn::count_min_sketch: cannot merge sketches of different dimensions.");
+        std::transform(counters_.begin(), counters_.end(), other.counters_.begin(), counters_.begin(),
+                       [](uint64_t lhs, uint64_t rhs) { return lhs + rhs; });
+        total_count_ += other.total_count_;
+    }
+
+    inline void clear()
+    {
+        std::fill(counters_.begin(), counters_.end(), 0);
+        total_count_ = 0;
+    }
+
+    inline std::size_t size_in_bytes() const { return counters_.size() * sizeof(uint64_t); }
+
+private:
+    inline std::size_t column_(uint64_t hash, std::size_t row) const
+    {
+        // Kirsch-Mitzenmacher double hashing, then multiply-high range reduction: no modulo, any width.
+        const uint32_t step = static_cast<uint32_t>(hash >> 32) | 1;
+        const uint32_t row_hash = static_cast<uint32_t>(hash) + static_cast<uint32_t>(row) * step;
+        return static_cast<std::size_t>((static_cast<uint64_t>(row_hash) * width_) >> 32);
+    }
+
+private:
+    std::size_t width_;
+    std::size_t depth_;
+    std::vector<uint64_t> counters_;
+    uint64_t total_count_ = 0;
+};
+
+} // namespace strn
+} // namespace arba
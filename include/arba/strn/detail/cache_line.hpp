@@ -0,0 +1,22 @@
+#pragma once
+
+#include <cstddef>
+
+inline namespace arba
+{
+namespace strn
+{
+namespace detail
+{
+
+/**
+ * @brief The alignment which keeps data written by different threads on different cache lines.
+ *
+ * std::hardware_destructive_interference_size is not used: its value depends on the compiler flags, and GCC warns
+ * on its use in headers.
+ */
+inline constexpr std::size_t cache_line_size = 64;
+
+} // namespace detail
+} // namespace strn
+} // namespace arba
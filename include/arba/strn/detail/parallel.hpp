@@ -0,0 +1,59 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <thread>
+#include <vector>
+
+inline namespace arba
+{
+namespace strn
+{
+namespace detail
+{
+
+/**
+ * @brief The number of threads to use: requested, or std::thread::hardware_concurrency() if requested is 0.
+ */
+inline std::size_t thread_count(std::size_t requested)
+{
+    return requested != 0 ? requested : std::max(1u, std::thread::hardware_concurrency());
+}
+
+/**
+ * @brief Call function(i) for i in [0, count), each call in its own thread (the first one in the calling thread).
+ *
+ * The first exception thrown by a call is rethrown once all the calls have returned. The threads are joined on every
+ * path, including when starting a thread throws.
+ */
+template <class Function>
+void run_parallel(std::size_t count, const Function& function)
+{
+    std::vector<std::exception_ptr> exceptions(count);
+    const auto run = [&](std::size_t index) {
+        try
+        {
+            function(index);
+        }
+        catch (...)
+        {
+            exceptions[index] = std::current_exception();
+        }
+    };
+    {
+        // Declared after what the threads use, and joined by its destructor.
+        std::vector<std::jthread> threads;
+        threads.reserve(count);
+        for (std::size_t index = 1; index < count; ++index)
+            threads.emplace_back(run, index);
+        run(0);
+    }
+    for (const std::exception_ptr& exception : exceptions)
+        if (exception)
+            std::rethrow_exception(exception);
+}
+
+} // namespace detail
+} // namespace strn
+} // namespace arba
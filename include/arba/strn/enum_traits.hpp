@@ -0,0 +1,116 @@
+#pragma once
+
+#include "static_map.hpp"
+#include "string32.hpp"
+#include "string56.hpp"
+#include "string64.hpp"
+
+#include <array>
+#include <optional>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+inline namespace arba
+{
+namespace strn
+{
+
+/**
+ * @brief The enum_registry struct lists the enumerators of an enum whose values are names (_e64, _e56 or _e32).
+ *
+ * Specialize it for each such enum, with a values array. The string type is string64 for 8-byte enums and string32
+ * for 4-byte enums, unless a string_type member says otherwise (string56 for _e56 values).
+ *
+ * enum class side : uint64_t { buy = "BUY"_e64, sell = "SELL"_e64 };
+ * template <>
+ * struct strn::enum_registry<side>
+ * {
+ *     inline constexpr static std::array values{ side::buy, side::sell };
+ * };
+ */
+template <class Enum>
+struct enum_registry;
+
+class enum_traits_
+{
+    template <class Enum>
+    friend class enum_traits;
+
+    template <class Registry>
+    static auto string_type_()
+    {
+        if constexpr (requires { typename Registry::string_type; })
+            return std::type_identity<typename Registry::string_type>();
+        else if constexpr (sizeof(decltype(Registry::values[0])) == sizeof(uint32_t))
+            return std::type_identity<string32>();
+        else
+            return std::type_identity<string64>();
+    }
+};
+
+/**
+ * @brief The enum_traits class gives the compile-time registry of an enum listed by enum_registry.
+ *
+ * The names are looked up in a static_map: is_valid(), parse() and index_of() are two multiplies, one pilot load
+ * and one compare, whatever the number of enumerators.
+ *
+ * using traits = strn::enum_traits<side>;
+ * if (std::optional<side> value = traits::parse(field)) { ... }
+ * std::array<int, traits::size()> counts{};
+ * ++counts[traits::index_of(*value)];
+ */
+template <class Enum>
+class enum_traits
+{
+private:
+    using registry_ = enum_registry<Enum>;
+
+public:
+    using enum_type = Enum;
+    using string_type = typename decltype(enum_traits_::string_type_<registry_>())::type;
+
+    static_assert(std::is_enum_v<Enum> && sizeof(Enum) == sizeof(typename string_type::uint),
+                  "enum_traits requires an enum of the size of its string type.");
+
+private:
+    inline constexpr static auto indexes_ = make_static_map([] {
+        std::array<std::pair<string_type, std::size_t>, registry_::values.size()> pairs;
+        for (std::size_t i = 0; i < pairs.size(); ++i)
+            pairs[i] = { string_type(registry_::values[i]), i };
+        return pairs;
+    });
+
+public:
+    /**
+     * @brief The enumerators, in the order of the registry.
+     */
+    inline constexpr static const auto& values() { return registry_::values; }
+    inline constexpr static std::size_t size() { return registry_::values.size(); }
+
+    inline constexpr static bool is_valid(Enum value) { return indexes_.contains(string_type(value)); }
+
+    /**
+     * @brief The index of an enumerator in values(), to use enumerators as indexes of dense arrays.
+     * @return size() if value is not an enumerator.
+     */
+    inline constexpr static std::size_t index_of(Enum value) { return indexes_.value_or(string_type(value), size()); }
+
+    inline constexpr static string_type to_string_n(Enum value) { return string_type(value); }
+
+    /**
+     * @brief Get the enumerator whose name is str.
+     * @return std::nullopt if no enumerator has this name.
+     */
+    static std::optional<Enum> parse(std::string_view str)
+    {
+        if (str.length() > string_type::max_length())
+            return std::nullopt;
+        if (const std::size_t* index = indexes_.find(string_type(str)))
+            return values()[*index];
+        return std::nullopt;
+    }
+};
+
+} // namespace strn
+} // namespace arba
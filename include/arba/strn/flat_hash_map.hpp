@@ -0,0 +1,298 @@
+#pragma once
+
+#include "hash_policy.hpp"
+#include "stats.hpp"
+#include "string_n_traits.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <utility>
+#include <vector>
+
+inline namespace arba
+{
+namespace strn
+{
+
+/**
+ * @brief The flat_hash_map class is an open addressing (linear probing) hash table whose keys are string-N values.
+ *
+ * Keys and values are stored inline in a power-of-two array of slots. A slot is empty when its key is empty, the
+ * value of the empty key itself being stored aside. The slot index is taken from the high bits of the hash, which
+ * suits mum_hash and fibonacci_hash. The hash of any other policy (identity_hash, std::hash) is multiplied by the
+ * golden ratio first (see spread_high_bits()): its high bits may be null for short keys.
+ *
+ * strn::flat_hash_map<strn::string64, int> map;
+ * map["AAPL"_s64] = 1;
+ * if (const int* value = map.find("AAPL"_s64)) { ... }
+ */
+template <string_n Key, class Value, class Hash = mum_hash>
+class flat_hash_map
+{
+public:
+    using key_type = Key;
+    using mapped_type = Value;
+    using hasher = Hash;
+
+private:
+    struct slot_
+    {
+        key_type key{};
+        Value value{};
+    };
+
+    inline constexpr static std::size_t min_capacity_ = 8;
+    inline constexpr static std::size_t batch_group_size_ = 16;
+
+public:
+    /**
+     * @brief flat_hash_map
+     * @param expected_size The number of keys the table is sized for, without rehashing.
+     */
+    explicit flat_hash_map(std::size_t expected_size = 0, const Hash& hash = Hash()) : hash_(hash)
+    {
+        rehash_(capacity_for_(expected_size));
+    }
+
+    inline std::size_t size() const { return size_ + empty_key_value_.has_value(); }
+    inline bool empty() const { return size() == 0; }
+    inline std::size_t capacity() const { return slots_.size(); }
+
+    inline void clear()
+    {
+        std::fill(slots_.begin(), slots_.end(), slot_{});
+        empty_key_value_.reset();
+        size_ = 0;
+    }
+
+    inline void reserve(std::size_t expected_size)
+    {
+        if (const std::size_t capacity = capacity_for_(expected_size); capacity > slots_.size())
+            rehash_(capacity);
+    }
+
+    /**
+     * @brief Insert a value if the key is not present.
+     * @return A pointer to the value mapped to the key, and true if the insertion took place.
+     */
+    std::pair<Value*, bool> insert(const key_type& key, Value value)
+    {
+        if (key.empty())
+        {
+            const bool inserted = !empty_key_value_.has_value();
+            if (inserted)
+                empty_key_value_.emplace(std::move(value));
+            return { &*empty_key_value_, inserted };
+        }
+        if ((size_ + 1) * 4 > slots_.size() * 3)
+            rehash_(slots_.size() * 2);
+        std::size_t index = home_index_(key);
+        for (;; index = (index + 1) & mask_())
+        {
+            slot_& slot = slots_[index];
+            if (slot.key == key)
+                return { &slot.value, false };
+            if (slot.key.empty())
+            {
+                slot.key = key;
+                slot.value = std::move(value);
+                ++size_;
+                return { &slot.value, true };
+            }
+        }
+    }
+
+    /**
+     * @brief Insert a value, or assign it if the key is already present.
+     * @return true if the insertion took place, false if the assignment took place.
+     */
+    inline bool insert_or_assign(const key_type& key, Value value)
+    {
+        if (Value* value_ptr = find(key))
+        {
+            *value_ptr = std::move(value);
+            return false;
+        }
+        insert(key, std::move(value));
+        return true;
+    }
+
+    inline Value& operator[](const key_type& key) { return *insert(key, Value()).first; }
+
+    inline Value* find(const key_type& key) { return const_cast<Value*>(std::as_const(*this).find(key)); }
+
+    inline const Value* find(const key_type& key) const
+    {
+        if (key.empty())
+            return empty_key_value_ ? &*empty_key_value_ : nullptr;
+        return probe_(key, home_index_(key));
+    }
+
+    inline bool contains(const key_type& key) const { return find(key) != nullptr; }
+
+    /**
+     * @brief The number of slots a lookup of the key examines, to check how well the hash spreads the keys.
+     */
+    std::size_t probe_length(const key_type& key) const
+    {
+        if (key.empty())
+            return 0;
+        std::size_t probes = 1;
+        for (std::size_t index = home_index_(key); slots_[index].key != key && !slots_[index].key.empty();
+             index = (index + 1) & mask_())
+            ++probes;
+        return probes;
+    }
+
+    /**
+     * @brief Look up a batch of keys.
+     * @param keys The keys to look up.
+     * @param values The output: values[i] points to the value of keys[i], or is null if keys[i] is not present.
+     * Only min(keys.size(), values.size()) keys are looked up.
+     * @return The number of keys found.
+     *
+     * Keys are processed in groups: the hashes of a whole group are computed and its home slots prefetched before
+     * the first probe, so that the cache misses of a group are served in parallel rather than one after the other.
+     */
+    std::size_t find_batch(std::span<const key_type> keys, std::span<const Value*> values) const
+    {
+        const std::size_t count = std::min(keys.size(), values.size());
+        std::size_t found = 0;
+        std::array<std::size_t, batch_group_size_> hashes;
+        for (std::size_t first = 0; first < count; first += batch_group_size_)
+        {
+            const std::size_t group_size = std::min(batch_group_size_, count - first);
+            hash_batch(keys.subspan(first, group_size), std::span(hashes).first(group_size), hash_);
+            for (std::size_t i = 0; i < group_size; ++i)
+                prefetch_(&slots_[index_of_(hashes[i])]);
+            for (std::size_t i = 0; i < group_size; ++i)
+            {
+                const key_type& key = keys[first + i];
+                const Value* value = key.empty() ? (empty_key_value_ ? &*empty_key_value_ : nullptr)
+                                                 : probe_(key, index_of_(hashes[i]));
+                values[first + i] = value;
+                found += value != nullptr;
+            }
+        }
+        return found;
+    }
+
+    /**
+     * @brief Remove a key.
+     * @return true if the key was present.
+     *
+     * The following keys of the probe sequence are shifted back, so no tombstone is left.
+     */
+    bool erase(const key_type& key)
+    {
+        if (key.empty())
+            return empty_key_value_ ? (empty_key_value_.reset(), true) : false;
+        std::size_t index = home_index_(key);
+        for (;; index = (index + 1) & mask_())
+        {
+            if (slots_[index].key == key)
+                break;
+            if (slots_[index].key.empty())
+                return false;
+        }
+        for (std::size_t next = (index + 1) & mask_(); !slots_[next].key.empty(); next = (next + 1) & mask_())
+        {
+            // The key of next can fill the hole only if its home slot is not in (index, next].
+            const std::size_t home = home_index_(slots_[next].key);
+            if (((next - home) & mask_()) >= ((next - index) & mask_()))
+            {
+                slots_[index] = std::move(slots_[next]);
+                index = next;
+            }
+        }
+        slots_[index] = slot_{};
+        --size_;
+        return true;
+    }
+
+    /**
+     * @brief Visit every (key, value) pair, in no particular order.
+     */
+    template <class Function>
+    void for_each(Function&& function) const
+    {
+        if (empty_key_value_)
+            function(key_type(), *empty_key_value_);
+        for (const slot_& slot : slots_)
+            if (!slot.key.empty())
+                function(slot.key, slot.value);
+    }
+
+    template <class Function>
+    void for_each(Function&& function)
+    {
+        if (empty_key_value_)
+            function(key_type(), *empty_key_value_);
+        for (slot_& slot : slots_)
+            if (!slot.key.empty())
+                function(std::as_const(slot.key), slot.value);
+    }
+
+private:
+    inline static std::size_t capacity_for_(std::size_t expected_size)
+    {
+        return std::max(min_capacity_, std::bit_ceil(expected_size + expected_size / 3 + 1));
+    }
+
+    inline std::size_t mask_() const { return slots_.size() - 1; }
+    inline std::size_t index_of_(std::size_t hash) const
+    {
+        return static_cast<std::size_t>(spread_high_bits<Hash>(hash) >> shift_);
+    }
+    inline std::size_t home_index_(const key_type& key) const { return index_of_(hash_(key)); }
+
+    inline const Value* probe_(const key_type& key, std::size_t index) const
+    {
+        for (std::size_t probes = 1;; ++probes, index = (index + 1) & mask_())
+        {
+            const slot_& slot = slots_[index];
+            if (slot.key == key || slot.key.empty())
+            {
+                stats::record_probes(stats::container::flat_hash_map, probes);
+                return slot.key.empty() ? nullptr : &slot.value;
+            }
+        }
+    }
+
+    inline static void prefetch_([[maybe_unused]] const void* address)
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        __builtin_prefetch(address);
+#endif
+    }
+
+    void rehash_(std::size_t capacity)
+    {
+        std::vector<slot_> old_slots(capacity);
+        old_slots.swap(slots_);
+        shift_ = 64 - std::countr_zero(capacity);
+        for (slot_& slot : old_slots)
+        {
+            if (slot.key.empty())
+                continue;
+            std::size_t index = home_index_(slot.key);
+            while (!slots_[index].key.empty())
+                index = (index + 1) & mask_();
+            slots_[index] = std::move(slot);
+        }
+    }
+
+private:
+    std::vector<slot_> slots_;
+    std::optional<Value> empty_key_value_;
+    std::size_t size_ = 0;
+    unsigned shift_ = 64;
+    [[no_unique_address]] Hash hash_;
+};
+
+} // namespace strn
+} // namespace arba
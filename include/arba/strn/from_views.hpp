@@ -0,0 +1,130 @@
+#pragma once
+
+#include "bitmask.hpp"
+#include "stats.hpp"
+#include "string_n_cast.hpp"
+#include "string_n_traits.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <string_view>
+
+inline namespace arba
+{
+namespace strn
+{
+
+class string_view_loader_
+{
+    template <string_n StringN>
+    friend StringN from_view(std::string_view str, truncation_policy policy, bool& truncated);
+
+    template <class UInt>
+    inline static UInt load_(const char* data)
+    {
+        UInt value;
+        std::memcpy(&value, data, sizeof(UInt));
+        if constexpr (std::endian::native == std::endian::big)
+            value = byteswap_(value);
+        return value;
+    }
+
+    template <class UInt>
+    inline constexpr static UInt byteswap_(UInt value)
+    {
+        UInt result = 0;
+        for (std::size_t i = 0; i < sizeof(UInt); ++i, value >>= 8)
+            result = (result << 8) | (value & 0xff);
+        return result;
+    }
+
+    // Read the first length characters (length <= 8) of data, character i in bits [8*i, 8*i+8).
+    // Short inputs use overlapping loads, so no byte outside [data, data + length) is ever read.
+    inline static uint64_t load_prefix_(const char* data, std::size_t length)
+    {
+        if (length >= 8)
+            return load_<uint64_t>(data);
+        if (length >= 4)
+        {
+            const uint64_t low = load_<uint32_t>(data);
+            const uint64_t high = load_<uint32_t>(data + length - 4);
+            return low | (high << (8 * (length - 4)));
+        }
+        if (length == 0)
+            return 0;
+        const uint64_t first = static_cast<uint8_t>(data[0]);
+        const uint64_t middle = static_cast<uint8_t>(data[length / 2]);
+        const uint64_t last = static_cast<uint8_t>(data[length - 1]);
+        return first | (middle << (8 * (length / 2))) | (last << (8 * (length - 1)));
+    }
+};
+
+/**
+ * @brief Build a string-N from a string_view with a few loads, shifts and masks.
+ * @param str The input characters.
+ * @param policy What to do if str is longer than StringN::max_length().
+ * @param truncated Set to true if str is longer than StringN::max_length(), false otherwise.
+ *
+ * The result is identical to the one of the string_view constructor (when policy is truncate).
+ */
+template <string_n StringN>
+inline StringN from_view(std::string_view str, truncation_policy policy, bool& truncated)
+{
+    using uint = typename StringN::uint;
+    constexpr std::size_t max_length = StringN::max_length();
+    constexpr bool stores_length = max_length < sizeof(uint);
+
+    stats::record_construction(stats::string_type_v<StringN>, str.length());
+    truncated = str.length() > max_length;
+    if (truncated && policy == truncation_policy::clear)
+        return StringN();
+
+    const std::size_t length = std::min(str.length(), max_length);
+    uint64_t value = string_view_loader_::load_prefix_(str.data(), length);
+    if constexpr (stores_length)
+        value = (value & ((uint64_t(1) << (8 * max_length)) - 1)) | (uint64_t(length) << (8 * max_length));
+    else if constexpr (sizeof(uint) < sizeof(uint64_t))
+        value &= (uint64_t(1) << (8 * sizeof(uint))) - 1;
+    if constexpr (std::endian::native == std::endian::big)
+        value = string_view_loader_::byteswap_(value) >> (8 * (sizeof(uint64_t) - sizeof(uint)));
+    return StringN::from_integer(static_cast<uint>(value));
+}
+
+/**
+ * @brief Build a string-N for each string_view of a batch.
+ * @param views The input strings.
+ * @param out The output string-N values: out[i] is built from views[i]. Only min(views.size(), out.size()) values
+ * are built.
+ * @param policy What to do with inputs longer than StringN::max_length().
+ * @param truncated If not null, resized to the number of built values: bit i is set if views[i] was too long.
+ * @return The number of too long inputs.
+ *
+ * std::vector<std::string_view> fields = ...;
+ * std::vector<strn::string64> keys(fields.size());
+ * strn::bitmask truncated;
+ * strn::from_views<strn::string64>(fields, keys, strn::truncation_policy::truncate, &truncated);
+ */
+template <string_n StringN>
+std::size_t from_views(std::span<const std::string_view> views, std::span<StringN> out,
+                       truncation_policy policy = truncation_policy::truncate, bitmask* truncated = nullptr)
+{
+    const std::size_t count = std::min(views.size(), out.size());
+    std::size_t truncated_count = 0;
+    if (truncated)
+        truncated->resize(count);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        bool is_truncated = false;
+        out[i] = from_view<StringN>(views[i], policy, is_truncated);
+        truncated_count += is_truncated;
+        if (truncated && is_truncated)
+            truncated->set(i);
+    }
+    return truncated_count;
+}
+
+} // namespace strn
+} // namespace arba
@@ -0,0 +1,128 @@
+#pragma once
+
+#include "detail/parallel.hpp"
+#include "flat_hash_map.hpp"
+#include "hash_policy.hpp"
+#include "string_n_traits.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <span>
+#include <utility>
+#include <vector>
+
+inline namespace arba
+{
+namespace strn
+{
+
+template <string_n Key>
+std::vector<std::pair<Key, uint64_t>> count_by(std::span<const Key> keys, std::size_t thread_count = 0);
+template <string_n Key, class Value, class Op = std::plus<Value>>
+std::vector<std::pair<Key, Value>> aggregate_by(std::span<const Key> keys, std::span<const Value> values, Op op = Op(),
+                                                std::size_t thread_count = 0);
+
+class group_by_
+{
+    template <string_n Key>
+    friend std::vector<std::pair<Key, uint64_t>> count_by(std::span<const Key> keys, std::size_t thread_count);
+    template <string_n Key, class Value, class Op>
+    friend std::vector<std::pair<Key, Value>> aggregate_by(std::span<const Key> keys, std::span<const Value> values,
+                                                           Op op, std::size_t thread_count);
+
+    // Smaller inputs are not worth starting a thread.
+    inline constexpr static std::size_t min_keys_per_thread_ = std::size_t(1) << 16;
+
+    inline static std::size_t thread_count_(std::size_t requested, std::size_t key_count)
+    {
+        return std::clamp<std::size_t>(key_count / min_keys_per_thread_, 1, detail::thread_count(requested));
+    }
+
+    // Each thread aggregates a chunk of the keys into one partial table per partition, the partition being taken from
+    // the low bits of the key hash (the tables index their slots with the high bits). Then each thread merges the
+    // partial tables of one partition, whose keys no other partition holds.
+    template <string_n Key, class Value, class ValueOf, class Op>
+    static std::vector<std::pair<Key, Value>> group_(std::span<const Key> keys, const ValueOf& value_of, const Op& op,
+                                                     std::size_t thread_count)
+    {
+        using table_type = flat_hash_map<Key, Value>;
+        const std::size_t count = thread_count_(thread_count, keys.size());
+        const auto accumulate = [&op](table_type& table, const Key& key, const Value& value) {
+            if (auto [accumulated, inserted] = table.insert(key, value); !inserted)
+                *accumulated = op(*accumulated, value);
+        };
+
+        std::vector<std::vector<table_type>> partials(count);
+        detail::run_parallel(count, [&](std::size_t thread_index) {
+            std::vector<table_type>& tables = partials[thread_index];
+            tables.resize(count);
+            const std::size_t first = keys.size() * thread_index / count;
+            const std::size_t last = keys.size() * (thread_index + 1) / count;
+            for (std::size_t i = first; i < last; ++i)
+            {
+                const uint64_t hash = static_cast<uint32_t>(mum_mix(keys[i].integer()));
+                accumulate(tables[(hash * count) >> 32], keys[i], value_of(i));
+            }
+        });
+
+        std::vector<std::vector<std::pair<Key, Value>>> groups(count);
+        detail::run_parallel(count, [&](std::size_t partition) {
+            table_type& table = partials[0][partition];
+            for (std::size_t thread_index = 1; thread_index < count; ++thread_index)
+            {
+                partials[thread_index][partition].for_each(
+                    [&](const Key& key, const Value& value) { accumulate(table, key, value); });
+                partials[thread_index][partition].clear();
+            }
+            groups[partition].reserve(table.size());
+            table.for_each([&](const Key& key, const Value& value) { groups[partition].emplace_back(key, value); });
+        });
+
+        std::vector<std::pair<Key, Value>> result = std::move(groups[0]);
+        for (std::size_t partition = 1; partition < count; ++partition)
+            result.insert(result.end(), groups[partition].begin(), groups[partition].end());
+        return result;
+    }
+};
+
+/**
+ * @brief Count the occurrences of each distinct key.
+ * @param keys The keys.
+ * @param thread_count The maximal number of threads, 0 for std::thread::hardware_concurrency(). Inputs smaller than
+ * 64 Ki keys per thread use fewer threads.
+ * @return The (key, count) pairs, in no particular order. std::sort() sorts them in the integer() order of the keys,
+ * which is not the alphabetical order on little endian hosts.
+ *
+ * std::vector<std::pair<strn::string64, uint64_t>> counts = strn::count_by<strn::string64>(symbols);
+ */
+template <string_n Key>
+std::vector<std::pair<Key, uint64_t>> count_by(std::span<const Key> keys, std::size_t thread_count)
+{
+    return group_by_::group_<Key, uint64_t>(
+        keys, [](std::size_t) { return uint64_t(1); }, std::plus<uint64_t>(), thread_count);
+}
+
+/**
+ * @brief Aggregate the values of each distinct key.
+ * @param keys The keys.
+ * @param values The values: values[i] is the value of keys[i]. Only min(keys.size(), values.size()) pairs are read.
+ * @param op The aggregation, called as op(aggregate, value) and returning the new aggregate. The aggregate of a key
+ * starts as its first value, and the values are aggregated in no particular order: op must be associative and
+ * commutative (sum, min, max...).
+ * @param thread_count The maximal number of threads, 0 for std::thread::hardware_concurrency().
+ * @return The (key, aggregate) pairs, in no particular order.
+ *
+ * auto volumes = strn::aggregate_by<strn::string64, uint64_t>(symbols, quantities, std::plus<>());
+ */
+template <string_n Key, class Value, class Op>
+std::vector<std::pair<Key, Value>> aggregate_by(std::span<const Key> keys, std::span<const Value> values, Op op,
+                                                std::size_t thread_count)
+{
+    keys = keys.first(std::min(keys.size(), values.size()));
+    return group_by_::group_<Key, Value>(
+        keys, [values](std::size_t i) -> const Value& { return values[i]; }, op, thread_count);
+}
+
+} // namespace strn
+} // namespace arba
@@ -0,0 +1,138 @@
+#pragma once
+
+#include "string_n_traits.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+inline namespace arba
+{
+namespace strn
+{
+
+/**
+ * @brief 64-bit multiplier derived from the golden ratio (2^64 / phi).
+ */
+inline constexpr uint64_t golden_ratio_64 = 0x9e3779b97f4a7c15ull;
+
+#if defined(__SIZEOF_INT128__)
+namespace detail
+{
+// __extension__ keeps -Wpedantic quiet: __int128 is a GCC and Clang extension.
+__extension__ typedef unsigned __int128 uint128_t;
+} // namespace detail
+#endif
+
+/**
+ * @brief Mix a 64-bit value with a single 64x64->128 multiplication, folding the high and low halves.
+ * @param value The value to mix.
+ * @param seed The multiplier (must be odd to keep the mix bijective on the low half).
+ * @return A value whose every bit depends on every bit of the input.
+ */
+inline constexpr uint64_t mum_mix(uint64_t value, uint64_t seed = golden_ratio_64)
+{
+#if defined(__SIZEOF_INT128__)
+    const detail::uint128_t product = static_cast<detail::uint128_t>(value) * seed;
+    return static_cast<uint64_t>(product >> 64) ^ static_cast<uint64_t>(product);
+#else
+    const uint64_t lo_v = value & 0xffffffff, hi_v = value >> 32;
+    const uint64_t lo_s = seed & 0xffffffff, hi_s = seed >> 32;
+    const uint64_t ll = lo_v * lo_s, lh = lo_v * hi_s, hl = hi_v * lo_s, hh = hi_v * hi_s;
+    const uint64_t mid = (ll >> 32) + (lh & 0xffffffff) + (hl & 0xffffffff);
+    const uint64_t hi = hh + (lh >> 32) + (hl >> 32) + (mid >> 32);
+    const uint64_t lo = (mid << 32) | (ll & 0xffffffff);
+    return hi ^ lo;
+#endif
+}
+
+/**
+ * @brief Hash policy returning the key integer itself (the behaviour of string_n::hash()).
+ */
+struct identity_hash
+{
+    template <string_n StringN>
+    inline constexpr std::size_t operator()(const StringN& key) const noexcept
+    {
+        return static_cast<std::size_t>(key.integer());
+    }
+};
+
+/**
+ * @brief Hash policy multiplying the key integer by the golden ratio (Fibonacci hashing).
+ *
+ * The high bits of the result are well mixed, the low bits are not: use it with tables indexed by the high bits.
+ */
+struct fibonacci_hash
+{
+    using high_bits_mixed = void;
+
+    template <string_n StringN>
+    inline constexpr std::size_t operator()(const StringN& key) const noexcept
+    {
+        return static_cast<std::size_t>(static_cast<uint64_t>(key.integer()) * golden_ratio_64);
+    }
+};
+
+/**
+ * @brief Hash policy mixing the key integer with one 128-bit multiplication (see mum_mix()).
+ *
+ * Every bit of the result is well mixed, so it can be used with power-of-two tables indexed by the low bits.
+ */
+struct mum_hash
+{
+    using high_bits_mixed = void;
+
+    template <string_n StringN>
+    inline constexpr std::size_t operator()(const StringN& key) const noexcept
+    {
+        return static_cast<std::size_t>(mum_mix(key.integer()));
+    }
+};
+
+/**
+ * @brief Whether the high bits of the hashes of a policy are well mixed, which the policy declares with a member type
+ * high_bits_mixed (see fibonacci_hash and mum_hash).
+ */
+template <class Hash>
+inline constexpr bool has_mixed_high_bits = requires { typename Hash::high_bits_mixed; };
+
+/**
+ * @brief The value whose high bits index a power-of-two table (see flat_hash_map).
+ * @param hash A hash computed by the policy Hash.
+ *
+ * The hash of a policy not declaring high_bits_mixed is multiplied by the golden ratio: identity_hash and
+ * std::hash<string32> return integer(), whose high bits are null for short keys.
+ */
+template <class Hash>
+inline constexpr uint64_t spread_high_bits(std::size_t hash)
+{
+    if constexpr (has_mixed_high_bits<Hash>)
+        return static_cast<uint64_t>(hash);
+    else
+        return static_cast<uint64_t>(hash) * golden_ratio_64;
+}
+
+/**
+ * @brief Hash a batch of keys with a hash policy.
+ * @param keys The keys to hash.
+ * @param hashes The output hashes: hashes[i] is the hash of keys[i]. Only min(keys.size(), hashes.size()) values are
+ * computed.
+ * @param hash The hash policy.
+ *
+ * The loop has no dependency between iterations, so the compiler vectorizes the identity and multiplicative
+ * policies, and overlaps the independent multiplications of mum_hash.
+ */
+template <string_n StringN, class Hash = mum_hash>
+inline void hash_batch(std::span<const StringN> keys, std::span<std::size_t> hashes, const Hash& hash = Hash())
+{
+    const std::size_t count = std::min(keys.size(), hashes.size());
+    const StringN* key_data = keys.data();
+    std::size_t* hash_data = hashes.data();
+    for (std::size_t i = 0; i < count; ++i)
+        hash_data[i] = hash(key_data[i]);
+}
+
+} // namespace strn
+} // namespace arba
@@ -0,0 +1,63 @@
+#pragma once
+
+#include "../binary_io.hpp"
+
+#include <cerrno>
+
+#if defined(_WIN32)
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+inline namespace arba
+{
+namespace strn
+{
+
+ARBA_STRN_INLINE bool binary_io_::write_all_(int fd, const std::byte* data, std::size_t size)
+{
+    while (size > 0)
+    {
+#if defined(_WIN32)
+        const auto written = ::_write(fd, data, static_cast<unsigned>(std::min<std::size_t>(size, 1u << 30)));
+#else
+        const auto written = ::write(fd, data, size);
+#endif
+        if (written < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            return false;
+        }
+        data += written;
+        size -= static_cast<std::size_t>(written);
+    }
+    return true;
+}
+
+ARBA_STRN_INLINE std::size_t binary_io_::read_all_(int fd, std::byte* data, std::size_t size)
+{
+    std::size_t total = 0;
+    while (total < size)
+    {
+#if defined(_WIN32)
+        const auto count = ::_read(fd, data + total, static_cast<unsigned>(std::min<std::size_t>(size - total, 1u << 30)));
+#else
+        const auto count = ::read(fd, data + total, size - total);
+#endif
+        if (count < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            break;
+        }
+        if (count == 0)
+            break;
+        total += static_cast<std::size_t>(count);
+    }
+    return total;
+}
+
+} // namespace strn
+} // namespace arba
@@ -0,0 +1,96 @@
+#pragma once
+
+#include "../block_reader.hpp"
+
+#include <cerrno>
+#include <system_error>
+
+#if defined(_WIN32)
+#include <fcntl.h>
+#include <io.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+inline namespace arba
+{
+namespace strn
+{
+
+ARBA_STRN_INLINE void block_reader::advise_sequential_([[maybe_unused]] int fd)
+{
+#if defined(POSIX_FADV_SEQUENTIAL)
+    ::posix_fadvise(fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+#endif
+}
+
+ARBA_STRN_INLINE block_reader::block_reader(int fd, const block_reader_options& options) : fd_(fd)
+{
+    if (options.sequential_hint)
+        advise_sequential_(fd_);
+}
+
+ARBA_STRN_INLINE block_reader::block_reader(const std::filesystem::path& path, const block_reader_options& options)
+    : owns_fd_(true)
+{
+#if defined(_WIN32)
+    fd_ = ::_wopen(path.c_str(), _O_RDONLY | _O_BINARY | _O_SEQUENTIAL);
+#else
+#if defined(O_DIRECT)
+    if (options.direct_io)
+    {
+        fd_ = ::open(path.c_str(), O_RDONLY | O_CLOEXEC | O_DIRECT);
+        direct_io_ = fd_ >= 0;
+    }
+#endif
+    // Without O_DIRECT support (EINVAL on some file systems), fall back to buffered reads.
+    if (fd_ < 0)
+        fd_ = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+#endif
+    if (fd_ < 0)
+        throw std::system_error(errno, std::generic_category(), path.string());
+    if (options.sequential_hint)
+        advise_sequential_(fd_);
+}
+
+ARBA_STRN_INLINE block_reader::~block_reader()
+{
+    if (owns_fd_ && fd_ >= 0)
+    {
+#if defined(_WIN32)
+        ::_close(fd_);
+#else
+        ::close(fd_);
+#endif
+    }
+}
+
+ARBA_STRN_INLINE std::size_t block_reader::read(std::span<std::byte> buffer)
+{
+    std::size_t total = 0;
+    while (total < buffer.size())
+    {
+#if defined(_WIN32)
+        const auto count = ::_read(fd_, buffer.data() + total, static_cast<unsigned>(buffer.size() - total));
+#else
+        const auto count = ::read(fd_, buffer.data() + total, buffer.size() - total);
+#endif
+        if (count < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            throw std::system_error(errno, std::generic_category(), "strn::block_reader::read");
+        }
+        if (count == 0)
+            break;
+        total += static_cast<std::size_t>(count);
+        // With O_DIRECT, a short read means the end of the file: a new read would be misaligned.
+        if (direct_io_)
+            break;
+    }
+    return total;
+}
+
+} // namespace strn
+} // namespace arba
@@ -0,0 +1,92 @@
+#pragma once
+
+#include "../io.hpp"
+#include "../string32.hpp"
+#include "../string56.hpp"
+#include "../string64.hpp"
+
+#include <iostream>
+#include <locale>
+#include <string>
+
+inline namespace arba
+{
+namespace strn
+{
+
+ARBA_STRN_INLINE std::ostream& operator<<(std::ostream& stream, const string64& str)
+{
+    uint8_t i = 0;
+    for (auto iter = str.begin(); stream && *iter && i < string64::max_length(); ++iter, ++i)
+        stream.put(*iter);
+    return stream;
+}
+
+ARBA_STRN_INLINE std::istream& operator>>(std::istream& stream, string64& str)
+{
+    char ch = 0;
+    std::locale loc = stream.getloc();
+    auto iter = str.begin();
+    for (uint8_t i = 0; stream && !stream.eof() && i < string64::max_length(); ++i, ++iter)
+    {
+        stream.get(ch);
+        if (!std::isspace(ch, loc))
+            *iter = ch;
+        else
+            break;
+    }
+    return stream;
+}
+
+ARBA_STRN_INLINE std::ostream& operator<<(std::ostream& stream, const string56& str)
+{
+    uint8_t i = 0;
+    for (auto iter = str.begin(); stream && *iter && i < string56::max_length(); ++iter, ++i)
+        stream.put(*iter);
+    return stream;
+}
+
+ARBA_STRN_INLINE std::istream& operator>>(std::istream& stream, string56& str)
+{
+    char ch = 0;
+    std::locale loc = stream.getloc();
+    auto iter = str.begin();
+    uint8_t i = 0;
+    for (; stream && !stream.eof() && i < string56::max_length(); ++i, ++iter)
+    {
+        stream.get(ch);
+        if (!std::isspace(ch, loc))
+            *iter = ch;
+        else
+            break;
+    }
+    *(str.begin() + str.max_length()) = i;
+    return stream;
+}
+
+ARBA_STRN_INLINE std::ostream& operator<<(std::ostream& stream, const string32& str)
+{
+    uint8_t i = 0;
+    for (auto iter = str.begin(); stream && *iter && i < string32::max_length(); ++iter, ++i)
+        stream.put(*iter);
+    return stream;
+}
+
+ARBA_STRN_INLINE std::istream& operator>>(std::istream& stream, string32& str)
+{
+    char ch = 0;
+    std::locale loc = stream.getloc();
+    auto iter = str.begin();
+    for (uint8_t i = 0; stream && !stream.eof() && i < string32::max_length(); ++i, ++iter)
+    {
+        stream.get(ch);
+        if (!std::isspace(ch, loc))
+            *iter = ch;
+        else
+            break;
+    }
+    return stream;
+}
+
+} // namespace strn
+} // namespace arba
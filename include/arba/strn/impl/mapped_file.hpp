@@ -0,0 +1,130 @@
+#pragma once
+
+#include "../mapped_file.hpp"
+
+#include <system_error>
+#include <utility>
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+inline namespace arba
+{
+namespace strn
+{
+
+#if defined(_WIN32)
+
+ARBA_STRN_INLINE mapped_file::mapped_file(const std::filesystem::path& path)
+{
+    HANDLE file = ::CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                                FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+        throw std::system_error(static_cast<int>(::GetLastError()), std::system_category(), path.string());
+    LARGE_INTEGER file_size;
+    if (!::GetFileSizeEx(file, &file_size))
+    {
+        const DWORD error = ::GetLastError();
+        ::CloseHandle(file);
+        throw std::system_error(static_cast<int>(error), std::system_category(), path.string());
+    }
+    size_ = static_cast<std::size_t>(file_size.QuadPart);
+    if (size_ == 0)
+    {
+        ::CloseHandle(file);
+        return;
+    }
+    HANDLE mapping = ::CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    const DWORD mapping_error = ::GetLastError();
+    ::CloseHandle(file);
+    if (mapping == nullptr)
+        throw std::system_error(static_cast<int>(mapping_error), std::system_category(), path.string());
+    data_ = static_cast<const std::byte*>(::MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+    const DWORD view_error = ::GetLastError();
+    ::CloseHandle(mapping);
+    if (data_ == nullptr)
+    {
+        size_ = 0;
+        throw std::system_error(static_cast<int>(view_error), std::system_category(), path.string());
+    }
+}
+
+ARBA_STRN_INLINE void mapped_file::close()
+{
+    if (data_)
+        ::UnmapViewOfFile(data_);
+    data_ = nullptr;
+    size_ = 0;
+}
+
+#else
+
+ARBA_STRN_INLINE mapped_file::mapped_file(const std::filesystem::path& path)
+{
+    const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0)
+        throw std::system_error(errno, std::generic_category(), path.string());
+    struct stat status;
+    if (::fstat(fd, &status) != 0)
+    {
+        const int error = errno;
+        ::close(fd);
+        throw std::system_error(error, std::generic_category(), path.string());
+    }
+    size_ = static_cast<std::size_t>(status.st_size);
+    if (size_ == 0)
+    {
+        ::close(fd);
+        return;
+    }
+    void* address = ::mmap(nullptr, size_, PROT_READ, MAP_SHARED, fd, 0);
+    const int error = errno;
+    ::close(fd);
+    if (address == MAP_FAILED)
+    {
+        size_ = 0;
+        throw std::system_error(error, std::generic_category(), path.string());
+    }
+    data_ = static_cast<const std::byte*>(address);
+}
+
+ARBA_STRN_INLINE void mapped_file::close()
+{
+    if (data_)
+        ::munmap(const_cast<std::byte*>(data_), size_);
+    data_ = nullptr;
+    size_ = 0;
+}
+
+#endif
+
+ARBA_STRN_INLINE mapped_file::mapped_file(mapped_file&& other) noexcept
+    : data_(std::exchange(other.data_, nullptr)), size_(std::exchange(other.size_, 0))
+{
+}
+
+ARBA_STRN_INLINE mapped_file& mapped_file::operator=(mapped_file&& other) noexcept
+{
+    if (this != &other)
+    {
+        close();
+        data_ = std::exchange(other.data_, nullptr);
+        size_ = std::exchange(other.size_, 0);
+    }
+    return *this;
+}
+
+ARBA_STRN_INLINE mapped_file::~mapped_file()
+{
+    close();
+}
+
+} // namespace strn
+} // namespace arba
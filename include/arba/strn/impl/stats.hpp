@@ -0,0 +1,136 @@
+#pragma once
+
+#include "../stats.hpp"
+
+#include <algorithm>
+#include <atomic>
+
+inline namespace arba
+{
+namespace strn
+{
+namespace stats
+{
+
+struct atomic_string_type_counters_
+{
+    std::atomic<uint64_t> constructed{ 0 };
+    std::atomic<uint64_t> truncated{ 0 };
+    std::atomic<uint64_t> bad_literals{ 0 };
+    std::array<std::atomic<uint64_t>, length_histogram_size> length_histogram{};
+};
+
+struct atomic_container_counters_
+{
+    std::atomic<uint64_t> lookups{ 0 };
+    std::atomic<uint64_t> probes{ 0 };
+    std::array<std::atomic<uint64_t>, probe_histogram_size> probe_histogram{};
+};
+
+struct atomic_counters_
+{
+    inline constexpr static std::array<std::size_t, 3> max_lengths = { 4, 7, 8 };
+
+    std::array<atomic_string_type_counters_, 3> string_types;
+    std::array<atomic_container_counters_, 2> containers;
+
+    template <class Value>
+    inline static void load(const std::atomic<Value>& counter, Value& value)
+    {
+        value = counter.load(std::memory_order_relaxed);
+    }
+
+    template <class Value, std::size_t Size>
+    inline static void load(const std::array<std::atomic<Value>, Size>& counters, std::array<Value, Size>& values)
+    {
+        for (std::size_t i = 0; i < Size; ++i)
+            load(counters[i], values[i]);
+    }
+
+    inline static string_type_counters load(const atomic_string_type_counters_& counters)
+    {
+        string_type_counters values;
+        load(counters.constructed, values.constructed);
+        load(counters.truncated, values.truncated);
+        load(counters.bad_literals, values.bad_literals);
+        load(counters.length_histogram, values.length_histogram);
+        return values;
+    }
+
+    inline static container_counters load(const atomic_container_counters_& counters)
+    {
+        container_counters values;
+        load(counters.lookups, values.lookups);
+        load(counters.probes, values.probes);
+        load(counters.probe_histogram, values.probe_histogram);
+        return values;
+    }
+
+    inline static void increment(std::atomic<uint64_t>& counter, uint64_t value = 1)
+    {
+        counter.fetch_add(value, std::memory_order_relaxed);
+    }
+};
+
+ARBA_STRN_INLINE atomic_counters_ counters_;
+
+ARBA_STRN_INLINE counters snapshot()
+{
+    counters values;
+    values.string32 = atomic_counters_::load(counters_.string_types[static_cast<std::size_t>(string_type::string32)]);
+    values.string56 = atomic_counters_::load(counters_.string_types[static_cast<std::size_t>(string_type::string56)]);
+    values.string64 = atomic_counters_::load(counters_.string_types[static_cast<std::size_t>(string_type::string64)]);
+    values.flat_hash_map
+        = atomic_counters_::load(counters_.containers[static_cast<std::size_t>(container::flat_hash_map)]);
+    values.mapped_table = atomic_counters_::load(counters_.containers[static_cast<std::size_t>(container::mapped_table)]);
+    return values;
+}
+
+ARBA_STRN_INLINE void reset()
+{
+    for (atomic_string_type_counters_& counters : counters_.string_types)
+    {
+        counters.constructed.store(0, std::memory_order_relaxed);
+        counters.truncated.store(0, std::memory_order_relaxed);
+        counters.bad_literals.store(0, std::memory_order_relaxed);
+        for (std::atomic<uint64_t>& counter : counters.length_histogram)
+            counter.store(0, std::memory_order_relaxed);
+    }
+    for (atomic_container_counters_& counters : counters_.containers)
+    {
+        counters.lookups.store(0, std::memory_order_relaxed);
+        counters.probes.store(0, std::memory_order_relaxed);
+        for (std::atomic<uint64_t>& counter : counters.probe_histogram)
+            counter.store(0, std::memory_order_relaxed);
+    }
+}
+
+#ifdef ARBA_STRN_STATS
+
+ARBA_STRN_INLINE void record_construction(string_type type, std::size_t input_length)
+{
+    atomic_string_type_counters_& counters = counters_.string_types[static_cast<std::size_t>(type)];
+    atomic_counters_::increment(counters.constructed);
+    if (input_length > atomic_counters_::max_lengths[static_cast<std::size_t>(type)])
+        atomic_counters_::increment(counters.truncated);
+    atomic_counters_::increment(counters.length_histogram[std::min(input_length, length_histogram_size - 1)]);
+}
+
+ARBA_STRN_INLINE void record_bad_literal(string_type type)
+{
+    atomic_counters_::increment(counters_.string_types[static_cast<std::size_t>(type)].bad_literals);
+}
+
+ARBA_STRN_INLINE void record_probes(container type, std::size_t probes)
+{
+    atomic_container_counters_& counters = counters_.containers[static_cast<std::size_t>(type)];
+    atomic_counters_::increment(counters.lookups);
+    atomic_counters_::increment(counters.probes, probes);
+    atomic_counters_::increment(counters.probe_histogram[std::min(probes, probe_histogram_size) - 1]);
+}
+
+#endif
+
+} // namespace stats
+} // namespace strn
+} // namespace arba
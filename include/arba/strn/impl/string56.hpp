@@ -0,0 +1,24 @@
+#pragma once
+
+#include "../string56.hpp"
+
+inline namespace arba
+{
+namespace strn
+{
+
+ARBA_STRN_INLINE bool string56::is_printable() const
+{
+    for (buffer_type_::const_iterator iter = cstr_.begin(), end_iter = end(); iter != end_iter; ++iter)
+    {
+        char ch = *iter;
+        if (ch == 0)
+            return true;
+        if (!isprint(ch))
+            return false;
+    }
+    return true;
+}
+
+} // namespace strn
+} // namespace arba
@@ -0,0 +1,23 @@
+#pragma once
+
+#include "../string64.hpp"
+
+inline namespace arba
+{
+namespace strn
+{
+
+ARBA_STRN_INLINE bool string64::is_printable() const
+{
+    for (buffer_type_::const_iterator iter = cstr_.begin(), end_iter = end(); iter != end_iter; ++iter)
+    {
+        if (*iter == 0)
+            return true;
+        if (!isprint(*iter))
+            return false;
+    }
+    return true;
+}
+
+} // namespace strn
+} // namespace arba
@@ -1,5 +1,7 @@
 #pragma once
 
+#include "config.hpp"
+
 #include <istream>
 #include <ostream>
 
@@ -25,3 +27,7 @@ std::istream& operator>>(std::istream& stream, string32& str);
 
 } // namespace strn
 } // namespace arba
+
+#ifdef ARBA_STRN_HEADER_ONLY
+#include "impl/io.hpp"
+#endif
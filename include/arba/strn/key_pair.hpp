@@ -0,0 +1,131 @@
+#pragma once
+
+#include "hash_policy.hpp"
+#include "string32.hpp"
+#include "string56.hpp"
+#include "string64.hpp"
+#include "string_n_formatter.hpp"
+
+#include <array>
+#include <compare>
+#include <cstdint>
+#include <format>
+#include <functional>
+#include <type_traits>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define ARBA_STRN_KEY_PAIR_SSE2 1
+#endif
+
+inline namespace arba
+{
+namespace strn
+{
+
+/**
+ * @brief The key_pair class is a composite key of two string-N values, e.g. (venue, symbol).
+ *
+ * Each value is stored as its integer widened to 64 bits, so a key_pair is 16 bytes, 16-byte aligned and has no
+ * padding: equality is one SSE2 compare of the two keys, and hash() mixes both halves with two independent
+ * multiplications (see mum_mix()), without a loop or a dependency between them.
+ *
+ * The order is the lexicographic order of (first(), second()), each compared like the string-N operator<, so a
+ * key_pair sorts like the std::pair of its values.
+ *
+ * strn::key_pair key("XNAS"_s64, "AAPL"_s64);
+ * std::unordered_map<strn::key_pair<strn::string64, strn::string64>, double> prices;
+ */
+template <string_n First, string_n Second>
+class alignas(2 * sizeof(uint64_t)) key_pair
+{
+public:
+    using first_type = First;
+    using second_type = Second;
+
+    inline constexpr key_pair() : words_{} {}
+
+    inline constexpr key_pair(const First& first, const Second& second)
+        : words_{ static_cast<uint64_t>(first.integer()), static_cast<uint64_t>(second.integer()) }
+    {
+    }
+
+    inline constexpr First first() const { return First::from_integer(static_cast<typename First::uint>(words_[0])); }
+    inline constexpr Second second() const
+    {
+        return Second::from_integer(static_cast<typename Second::uint>(words_[1]));
+    }
+
+    inline constexpr std::size_t hash() const
+    {
+        return static_cast<std::size_t>(mum_mix(words_[0], golden_ratio_64) ^ mum_mix(words_[1], second_seed_));
+    }
+
+    inline friend constexpr bool operator==(const key_pair& lhs, const key_pair& rhs)
+    {
+#ifdef ARBA_STRN_KEY_PAIR_SSE2
+        if (!std::is_constant_evaluated())
+        {
+            const __m128i lhs_words = _mm_load_si128(reinterpret_cast<const __m128i*>(lhs.words_.data()));
+            const __m128i rhs_words = _mm_load_si128(reinterpret_cast<const __m128i*>(rhs.words_.data()));
+            return _mm_movemask_epi8(_mm_cmpeq_epi8(lhs_words, rhs_words)) == 0xffff;
+        }
+#endif
+        return ((lhs.words_[0] ^ rhs.words_[0]) | (lhs.words_[1] ^ rhs.words_[1])) == 0;
+    }
+
+    inline friend constexpr std::strong_ordering operator<=>(const key_pair& lhs, const key_pair& rhs)
+    {
+        if (const std::strong_ordering order = lhs.words_[0] <=> rhs.words_[0]; order != 0)
+            return order;
+        return lhs.words_[1] <=> rhs.words_[1];
+    }
+
+private:
+    // An odd multiplier other than golden_ratio_64, so that (a, b) and (b, a) have different hashes.
+    inline constexpr static uint64_t second_seed_ = 0xc2b2ae3d27d4eb4full;
+
+private:
+    std::array<uint64_t, 2> words_;
+};
+
+static_assert(sizeof(key_pair<string32, string32>) == 2 * sizeof(uint64_t));
+
+} // namespace strn
+} // namespace arba
+
+/**
+ * @brief The std::hash<strn::key_pair<First, Second>> struct specialization
+ */
+template <arba::strn::string_n First, arba::strn::string_n Second>
+struct std::hash<arba::strn::key_pair<First, Second>>
+{
+    inline std::size_t operator()(const arba::strn::key_pair<First, Second>& value) const noexcept
+    {
+        return value.hash();
+    }
+};
+
+/**
+ * @brief The std::formatter<strn::key_pair<First, Second>> struct specialization
+ *
+ * The two values are written separated by a '/', each with the spec of the string-N formatter: "{:q}" gives
+ * "\"XNAS\"/\"AAPL\"".
+ */
+template <arba::strn::string_n First, arba::strn::string_n Second, class CharT>
+struct std::formatter<arba::strn::key_pair<First, Second>, CharT>
+{
+    constexpr auto parse(std::basic_format_parse_context<CharT>& ctx) { return formatter_.parse(ctx); }
+
+    template <class FormatContext>
+    auto format(const arba::strn::key_pair<First, Second>& value, FormatContext& ctx) const
+    {
+        auto out = formatter_.format(value.first(), ctx);
+        *out++ = '/';
+        ctx.advance_to(out);
+        return formatter_.format(value.second(), ctx);
+    }
+
+private:
+    ::arba::strn::string_n_formatter<First, CharT> formatter_;
+};
@@ -0,0 +1,50 @@
+#pragma once
+
+#include "config.hpp"
+
+#include <cstddef>
+#include <filesystem>
+#include <span>
+
+inline namespace arba
+{
+namespace strn
+{
+
+/**
+ * @brief The mapped_file class maps a whole file in memory, read-only.
+ *
+ * The pages are loaded on demand by the operating system and shared between the processes mapping the same file.
+ */
+class mapped_file
+{
+public:
+    mapped_file() = default;
+
+    /**
+     * @brief mapped_file
+     * @param path The file to map.
+     * @throw std::system_error If the file cannot be opened or mapped.
+     */
+    explicit mapped_file(const std::filesystem::path& path);
+    mapped_file(const mapped_file&) = delete;
+    mapped_file& operator=(const mapped_file&) = delete;
+    mapped_file(mapped_file&& other) noexcept;
+    mapped_file& operator=(mapped_file&& other) noexcept;
+    ~mapped_file();
+
+    inline bool is_open() const { return data_ != nullptr; }
+    inline std::span<const std::byte> bytes() const { return { data_, size_ }; }
+    void close();
+
+private:
+    const std::byte* data_ = nullptr;
+    std::size_t size_ = 0;
+};
+
+} // namespace strn
+} // namespace arba
+
+#ifdef ARBA_STRN_HEADER_ONLY
+#include "impl/mapped_file.hpp"
+#endif
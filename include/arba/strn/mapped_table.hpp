@@ -0,0 +1,287 @@
+#pragma once
+
+#include "flat_hash_map.hpp"
+#include "hash_policy.hpp"
+#include "mapped_file.hpp"
+#include "stats.hpp"
+#include "string_n_traits.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+inline namespace arba
+{
+namespace strn
+{
+
+/**
+ * @brief The header of a mapped_table file.
+ *
+ * The file is: this header, the key slots at keys_offset, then the value slots at values_offset. There are
+ * capacity key slots (an empty key marks an empty slot) and capacity + 1 value slots, the last one holding the value
+ * of the empty key. Keys and values are stored in the byte order of the host which built the file.
+ */
+struct mapped_table_header
+{
+    inline constexpr static char magic_value[8] = { 's', 't', 'r', 'n', 'm', 't', '0', '1' };
+    inline constexpr static uint32_t byte_order_value = 0x01020304;
+
+    char magic[8];
+    uint32_t byte_order;
+    uint32_t key_size;
+    uint32_t key_max_length;
+    uint32_t value_size;
+    uint64_t capacity;
+    uint64_t size;
+    uint64_t has_empty_key;
+    uint64_t keys_offset;
+    uint64_t values_offset;
+};
+static_assert(std::is_trivially_copyable_v<mapped_table_header>);
+
+template <string_n Key, class Value>
+    requires std::is_trivially_copyable_v<Value>
+class mapped_table_builder;
+
+/**
+ * @brief The mapped_table class serves read-only lookups directly from a memory-mapped file.
+ *
+ * Opening a table maps the file and checks its header, whatever its size: no key is parsed or copied, and the pages
+ * are shared by every process using the same file. The file is an open addressing (linear probing) table built by
+ * mapped_table_builder with a load factor of at most 1/2, so most lookups read a single key cache line.
+ *
+ * strn::mapped_table<strn::string64, uint64_t> table("reference.strnmt");
+ * if (const uint64_t* value = table.find("AAPL"_s64)) { ... }
+ */
+template <string_n Key, class Value>
+    requires std::is_trivially_copyable_v<Value>
+class mapped_table
+{
+public:
+    using key_type = Key;
+    using mapped_type = Value;
+
+    /**
+     * @brief mapped_table
+     * @param path The file written by mapped_table_builder.
+     * @throw std::system_error If the file cannot be mapped.
+     * @throw std::runtime_error If the file is not a table of Key and Value built on a host of the same byte order.
+     */
+    explicit mapped_table(const std::filesystem::path& path) : file_(path)
+    {
+        const std::span<const std::byte> bytes = file_.bytes();
+        mapped_table_header header;
+        if (bytes.size() < sizeof(header))
+            throw std::runtime_error("strn::mapped_table: file too short: " + path.string());
+        std::memcpy(&header, bytes.data(), sizeof(header));
+        if (std::memcmp(header.magic, mapped_table_header::magic_value, sizeof(header.magic)) != 0
+            || header.byte_order != mapped_table_header::byte_order_value)
+            throw std::runtime_error("strn::mapped_table: bad file header: " + path.string());
+        if (header.key_size != sizeof(Key) || header.key_max_length != Key::max_length()
+            || header.value_size != sizeof(Value))
+            throw std::runtime_error("strn::mapped_table: key or value type mismatch: " + path.string());
+        if (!valid_layout_(header, bytes.size()))
+            throw std::runtime_error("strn::mapped_table: corrupted file: " + path.string());
+        keys_ = reinterpret_cast<const Key*>(bytes.data() + header.keys_offset);
+        values_ = reinterpret_cast<const Value*>(bytes.data() + header.values_offset);
+        capacity_ = header.capacity;
+        size_ = header.size;
+        has_empty_key_ = header.has_empty_key != 0;
+        shift_ = 64 - std::countr_zero(capacity_);
+    }
+
+    inline std::size_t size() const { return size_; }
+    inline bool empty() const { return size_ == 0; }
+    inline std::size_t capacity() const { return capacity_; }
+
+    const Value* find(const key_type& key) const
+    {
+        if (key.empty())
+            return has_empty_key_ ? &values_[capacity_] : nullptr;
+        const std::size_t mask = capacity_ - 1;
+        std::size_t probes = 1;
+        // The probe count is bounded too: the header checks the size, not that the key slots hold an empty one.
+        for (std::size_t index = home_index_(key, shift_); probes <= capacity_; ++probes, index = (index + 1) & mask)
+        {
+            const key_type& slot_key = keys_[index];
+            if (slot_key == key || slot_key.empty())
+            {
+                stats::record_probes(stats::container::mapped_table, probes);
+                return slot_key.empty() ? nullptr : &values_[index];
+            }
+        }
+        return nullptr;
+    }
+
+    inline bool contains(const key_type& key) const { return find(key) != nullptr; }
+
+private:
+    template <string_n OtherKey, class OtherValue>
+        requires std::is_trivially_copyable_v<OtherValue>
+    friend class mapped_table_builder;
+
+    // The sections are checked with divisions rather than products, which a corrupted header could make wrap.
+    inline static bool valid_layout_(const mapped_table_header& header, std::size_t file_size)
+    {
+        if (!std::has_single_bit(header.capacity) || header.keys_offset % alignof(Key) != 0
+            || header.values_offset % alignof(Value) != 0 || header.keys_offset < sizeof(header)
+            || header.values_offset < sizeof(header) || header.keys_offset > file_size
+            || header.values_offset > file_size
+            || header.capacity > (file_size - header.keys_offset) / sizeof(Key)
+            || header.capacity >= (file_size - header.values_offset) / sizeof(Value))
+            return false;
+        const uint64_t keys_end = header.keys_offset + header.capacity * sizeof(Key);
+        const uint64_t values_end = header.values_offset + (header.capacity + 1) * sizeof(Value);
+        if (keys_end > header.values_offset && values_end > header.keys_offset)
+            return false;
+        // At least one key slot must be empty, so that a lookup of a missing key ends.
+        return header.has_empty_key <= 1 && header.size >= header.has_empty_key
+               && header.size - header.has_empty_key < header.capacity;
+    }
+
+    inline static std::size_t home_index_(const key_type& key, unsigned shift)
+    {
+        return static_cast<uint64_t>(mum_hash()(key)) >> shift;
+    }
+
+private:
+    mapped_file file_;
+    const Key* keys_ = nullptr;
+    const Value* values_ = nullptr;
+    std::size_t capacity_ = 0;
+    std::size_t size_ = 0;
+    unsigned shift_ = 64;
+    bool has_empty_key_ = false;
+};
+
+/**
+ * @brief The mapped_table_builder class collects (key, value) pairs and writes a mapped_table file.
+ *
+ * strn::mapped_table_builder<strn::string64, uint64_t> builder;
+ * builder.insert_or_assign("AAPL"_s64, 42);
+ * builder.write("reference.strnmt");
+ */
+template <string_n Key, class Value>
+    requires std::is_trivially_copyable_v<Value>
+class mapped_table_builder
+{
+private:
+    inline constexpr static std::size_t section_alignment_ = 64;
+
+public:
+    using key_type = Key;
+    using mapped_type = Value;
+
+    /**
+     * @brief The number of distinct keys added, which is the size of the written table.
+     */
+    inline std::size_t size() const { return keys_.size(); }
+
+    /**
+     * @brief Add a pair, or replace the value of a key which was already added.
+     */
+    void insert_or_assign(const key_type& key, const Value& value)
+    {
+        const auto [index, inserted] = indexes_.insert(key, keys_.size());
+        if (!inserted)
+        {
+            values_[*index] = value;
+            return;
+        }
+        keys_.push_back(key);
+        values_.push_back(value);
+    }
+
+    /**
+     * @brief Write the table.
+     * @throw std::runtime_error If the file cannot be written.
+     */
+    void write(const std::filesystem::path& path) const
+    {
+        std::ofstream stream(path, std::ios::binary | std::ios::trunc);
+        if (!write(stream))
+            throw std::runtime_error("strn::mapped_table_builder: cannot write: " + path.string());
+    }
+
+    std::ostream& write(std::ostream& stream) const
+    {
+        // The keys are distinct. They are placed in integer order, so that the file does not depend on the order
+        // of insertion.
+        std::vector<std::size_t> order(keys_.size());
+        for (std::size_t i = 0; i < order.size(); ++i)
+            order[i] = i;
+        std::ranges::sort(order, {}, [this](std::size_t i) { return keys_[i].integer(); });
+
+        const std::size_t capacity = std::max<std::size_t>(8, std::bit_ceil(keys_.size() * 2));
+        const unsigned shift = 64 - std::countr_zero(capacity);
+        std::vector<Key> keys(capacity);
+        std::vector<Value> values(capacity + 1);
+        mapped_table_header header{};
+        std::memcpy(header.magic, mapped_table_header::magic_value, sizeof(header.magic));
+        header.byte_order = mapped_table_header::byte_order_value;
+        header.key_size = sizeof(Key);
+        header.key_max_length = Key::max_length();
+        header.value_size = sizeof(Value);
+        header.capacity = capacity;
+        header.size = keys_.size();
+        for (const std::size_t pos : order)
+        {
+            if (keys_[pos].empty())
+            {
+                header.has_empty_key = 1;
+                values[capacity] = values_[pos];
+                continue;
+            }
+            std::size_t index = mapped_table<Key, Value>::home_index_(keys_[pos], shift);
+            while (!keys[index].empty())
+                index = (index + 1) & (capacity - 1);
+            keys[index] = keys_[pos];
+            values[index] = values_[pos];
+        }
+        header.keys_offset = align_(sizeof(header));
+        header.values_offset = align_(header.keys_offset + capacity * sizeof(Key));
+
+        std::size_t offset = 0;
+        write_bytes_(stream, offset, &header, sizeof(header));
+        write_padding_(stream, offset, header.keys_offset);
+        write_bytes_(stream, offset, keys.data(), keys.size() * sizeof(Key));
+        write_padding_(stream, offset, header.values_offset);
+        write_bytes_(stream, offset, values.data(), values.size() * sizeof(Value));
+        return stream;
+    }
+
+private:
+    inline static std::size_t align_(std::size_t offset)
+    {
+        static_assert(section_alignment_ % alignof(Value) == 0);
+        return (offset + section_alignment_ - 1) / section_alignment_ * section_alignment_;
+    }
+
+    inline static void write_bytes_(std::ostream& stream, std::size_t& offset, const void* data, std::size_t size)
+    {
+        stream.write(static_cast<const char*>(data), static_cast<std::streamsize>(size));
+        offset += size;
+    }
+
+    inline static void write_padding_(std::ostream& stream, std::size_t& offset, std::size_t new_offset)
+    {
+        for (; offset < new_offset; ++offset)
+            stream.put('\0');
+    }
+
+private:
+    std::vector<Key> keys_;
+    std::vector<Value> values_;
+    // The position of each key in keys_ and values_.
+    flat_hash_map<Key, std::size_t> indexes_;
+};
+
+} // namespace strn
+} // namespace arba
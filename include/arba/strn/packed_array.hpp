@@ -0,0 +1,241 @@
+#pragma once
+
+#include "string64.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+inline namespace arba
+{
+namespace strn
+{
+
+// The codecs work on character streams: the integer whose byte i (from the least significant one) is character i.
+// It is integer() on little endian hosts.
+
+/**
+ * @brief Codec of packed_array storing each character on 8 bits: any character can be stored.
+ */
+struct byte_codec
+{
+    inline constexpr static unsigned char_bits = 8;
+
+    inline constexpr static bool can_encode(char) { return true; }
+    inline constexpr static uint64_t encode(uint64_t chars) { return chars; }
+    inline constexpr static uint64_t decode(uint64_t code) { return code; }
+#if defined(__AVX2__)
+    inline static __m256i decode(__m256i codes) { return codes; }
+#endif
+};
+
+/**
+ * @brief Codec of packed_array storing each character on 6 bits: only the characters from '!' to '_' (upper case
+ * letters, digits and punctuation, not the space) can be stored.
+ *
+ * Character ch is stored as ch - 0x20, so that 0 still ends the string. The 6-bit codes are spread to bytes (and
+ * back) by three shift-and-mask steps, with no loop over the characters.
+ */
+struct sixbit_codec
+{
+    inline constexpr static unsigned char_bits = 6;
+
+    inline constexpr static bool can_encode(char ch) { return ch > ' ' && ch <= '_'; }
+
+    inline constexpr static uint64_t encode(uint64_t chars)
+    {
+        // Subtract 0x20 from the non-null bytes: a byte from '!' to '_' plus 0x7f has its high bit set, a null one not.
+        uint64_t codes = chars - (((chars + low_bytes_ * 0x7f) & high_bits_) >> 2);
+        codes = (codes & 0x003f003f003f003full) | ((codes & 0x3f003f003f003f00ull) >> 2);
+        codes = (codes & 0x00000fff00000fffull) | ((codes & 0x0fff00000fff0000ull) >> 4);
+        return (codes & 0x0000000000ffffffull) | ((codes & 0x00ffffff00000000ull) >> 8);
+    }
+
+    inline constexpr static uint64_t decode(uint64_t code)
+    {
+        uint64_t chars = (code & 0x0000000000ffffffull) | ((code & 0x0000ffffff000000ull) << 8);
+        chars = (chars & 0x00000fff00000fffull) | ((chars & 0x00fff00000fff000ull) << 4);
+        chars = (chars & 0x003f003f003f003full) | ((chars & 0x0fc00fc00fc00fc0ull) << 2);
+        // Add 0x20 to the non-null bytes: a byte from 1 to 63 plus 0x3f has its 0x40 bit set, a null one not.
+        return chars + (((chars + low_bytes_ * 0x3f) & (low_bytes_ * 0x40)) >> 1);
+    }
+
+#if defined(__AVX2__)
+    inline static __m256i decode(__m256i codes)
+    {
+        const auto spread = [](__m256i value, uint64_t low_mask, uint64_t high_mask, int shift) {
+            const __m256i low = _mm256_and_si256(value, _mm256_set1_epi64x(static_cast<long long>(low_mask)));
+            const __m256i high = _mm256_and_si256(value, _mm256_set1_epi64x(static_cast<long long>(high_mask)));
+            return _mm256_or_si256(low, _mm256_slli_epi64(high, shift));
+        };
+        __m256i chars = spread(codes, 0x0000000000ffffffull, 0x0000ffffff000000ull, 8);
+        chars = spread(chars, 0x00000fff00000fffull, 0x00fff00000fff000ull, 4);
+        chars = spread(chars, 0x003f003f003f003full, 0x0fc00fc00fc00fc0ull, 2);
+        const __m256i non_null
+            = _mm256_and_si256(_mm256_add_epi8(chars, _mm256_set1_epi8(0x3f)), _mm256_set1_epi8(0x40));
+        return _mm256_add_epi8(chars, _mm256_srli_epi64(non_null, 1));
+    }
+#endif
+
+private:
+    inline constexpr static uint64_t low_bytes_ = 0x0101010101010101ull;
+    inline constexpr static uint64_t high_bits_ = low_bytes_ * 0x80;
+};
+
+/**
+ * @brief The packed_array class stores short strings contiguously on Bits bits each, e.g. 40 bits for codes of at
+ * most 5 characters with byte_codec, or 36 bits for 6 characters with sixbit_codec.
+ *
+ * The values are given and returned as string64. A value is read with one or two word loads, a shift and a mask;
+ * unpack() decodes consecutive values in bulk (4 at a time with one gather when AVX2 is enabled).
+ *
+ * strn::packed_array<40> codes;
+ * codes.push_back("AAPL"_s64);
+ * strn::string64 code = codes[0];
+ */
+template <std::size_t Bits, class Codec = byte_codec>
+class packed_array
+{
+    static_assert(Bits > 0 && Bits <= 56, "packed_array values are 1 to 56 bits wide.");
+    static_assert(Bits % Codec::char_bits == 0, "packed_array values hold a whole number of characters.");
+
+public:
+    using value_type = string64;
+    using codec_type = Codec;
+
+    inline constexpr static std::size_t value_bits() { return Bits; }
+    inline constexpr static std::size_t max_length() { return Bits / Codec::char_bits; }
+
+    /**
+     * @brief Tell whether a value can be stored: it is not too long and the codec can encode its characters.
+     */
+    inline static bool can_store(const string64& value)
+    {
+        return value.length() <= max_length() && std::all_of(value.begin(), value.end(), &Codec::can_encode);
+    }
+
+    inline std::size_t size() const { return size_; }
+    inline bool empty() const { return size_ == 0; }
+
+    /**
+     * @brief The size of the storage, in bytes.
+     */
+    inline std::size_t storage_size() const { return words_.size() * sizeof(uint64_t); }
+
+    inline void reserve(std::size_t capacity) { words_.reserve(words_for_(capacity)); }
+
+    inline void clear()
+    {
+        words_.clear();
+        size_ = 0;
+    }
+
+    /**
+     * @brief Append a value.
+     * @throw std::invalid_argument If the value cannot be stored (see can_store()).
+     */
+    void push_back(const string64& value)
+    {
+        if (!can_store(value))
+            throw std::invalid_argument("strn::packed_array: value cannot be stored: " + value.to_string());
+        const std::size_t bit = size_ * Bits;
+        // The storage ends with a spare word, so that reading a value never checks for the end of the storage.
+        words_.resize(words_for_(size_ + 1), 0);
+        const uint64_t code = Codec::encode(char_stream_(value));
+        const std::size_t offset = bit % 64;
+        words_[bit / 64] |= code << offset;
+        words_[bit / 64 + 1] |= (code >> 1) >> (63 - offset);
+        ++size_;
+    }
+
+    void append(std::span<const string64> values)
+    {
+        reserve(size_ + values.size());
+        for (const string64& value : values)
+            push_back(value);
+    }
+
+    inline string64 operator[](std::size_t index) const
+    {
+        const std::size_t bit = index * Bits;
+        const std::size_t offset = bit % 64;
+        const uint64_t code = (words_[bit / 64] >> offset) | ((words_[bit / 64 + 1] << 1) << (63 - offset));
+        return from_char_stream_(Codec::decode(code & value_mask_));
+    }
+
+    /**
+     * @brief Decode consecutive values.
+     * @param first The index of the first value to decode.
+     * @param values The output values: values[i] is the value of index first + i.
+     * @return The number of decoded values, min(values.size(), size() - first).
+     */
+    std::size_t unpack(std::size_t first, std::span<string64> values) const
+    {
+        const std::size_t count = first < size_ ? std::min(values.size(), size_ - first) : 0;
+        std::size_t i = 0;
+#if defined(__AVX2__)
+        // x86 is little endian: a value is the 8 bytes from the byte of its first bit, shifted and masked.
+        const long long* base = reinterpret_cast<const long long*>(words_.data());
+        const __m256i steps = _mm256_set_epi64x(3 * Bits, 2 * Bits, Bits, 0);
+        const __m256i byte_mask = _mm256_set1_epi64x(7);
+        const __m256i value_mask = _mm256_set1_epi64x(static_cast<long long>(value_mask_));
+        for (; i + 4 <= count; i += 4)
+        {
+            const __m256i bits
+                = _mm256_add_epi64(_mm256_set1_epi64x(static_cast<long long>((first + i) * Bits)), steps);
+            const __m256i words = _mm256_i64gather_epi64(base, _mm256_srli_epi64(bits, 3), 1);
+            const __m256i shifts = _mm256_and_si256(bits, byte_mask);
+            const __m256i codes = _mm256_and_si256(_mm256_srlv_epi64(words, shifts), value_mask);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(values.data() + i), Codec::decode(codes));
+        }
+#endif
+        for (; i < count; ++i)
+            values[i] = (*this)[first + i];
+        return count;
+    }
+
+private:
+    inline constexpr static uint64_t value_mask_ = (uint64_t(1) << Bits) - 1;
+
+    inline static std::size_t words_for_(std::size_t size) { return (size * Bits + 63) / 64 + 1; }
+
+    inline static uint64_t char_stream_(const string64& value)
+    {
+        if constexpr (std::endian::native == std::endian::little)
+            return value.integer();
+        else
+        {
+            uint64_t chars = 0;
+            for (std::size_t i = 0; i < value.length(); ++i)
+                chars |= static_cast<uint64_t>(static_cast<uint8_t>(value[i])) << (8 * i);
+            return chars;
+        }
+    }
+
+    inline static string64 from_char_stream_(uint64_t chars)
+    {
+        if constexpr (std::endian::native == std::endian::little)
+            return string64::from_integer(chars);
+        else
+        {
+            string64 value;
+            for (std::size_t i = 0; i < string64::max_length(); ++i)
+                value[i] = static_cast<char>(chars >> (8 * i));
+            return value;
+        }
+    }
+
+private:
+    std::vector<uint64_t> words_;
+    std::size_t size_ = 0;
+};
+
+} // namespace strn
+} // namespace arba
@@ -0,0 +1,562 @@
+#pragma once
+
+#include "string_n_traits.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string_view>
+#include <utility>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define ARBA_STRN_RADIX_INDEX_SSE2 1
+#endif
+
+inline namespace arba
+{
+namespace strn
+{
+
+/**
+ * @brief The radix_index class is an adaptive radix tree (ART) mapping string-N keys to values.
+ *
+ * The key bytes are indexed in string order, so iteration, prefix_scan() and range_scan() visit the keys in
+ * alphabetical (std::string_view) order, unlike std::map<string64, V> which uses the integer operator<.
+ * Inner nodes grow from 4 to 16, 48 and 256 children. Since a key has at most 8 bytes, the depth is bounded and
+ * no prefix compression is needed: a subtree holding a single key is stored as a leaf (lazy expansion).
+ *
+ * strn::radix_index<strn::string64, int> index;
+ * index.insert("ABC"_s64, 1);
+ * index.prefix_scan("AB", [](const strn::string64& key, int value) { ... });
+ */
+template <string_n Key, class Value>
+class radix_index
+{
+public:
+    using key_type = Key;
+    using mapped_type = Value;
+
+private:
+    inline constexpr static std::size_t key_size_ = sizeof(key_type);
+
+    enum class node_type_ : uint8_t
+    {
+        leaf,
+        node4,
+        node16,
+        node48,
+        node256
+    };
+
+    struct node_
+    {
+        node_type_ type;
+        uint16_t count = 0;
+    };
+
+    struct leaf_ : node_
+    {
+        leaf_(const key_type& k, Value&& v) : node_{ node_type_::leaf }, key(k), value(std::move(v)) {}
+
+        key_type key;
+        Value value;
+    };
+
+    struct node4_ : node_
+    {
+        node4_() : node_{ node_type_::node4 } {}
+
+        std::array<uint8_t, 4> keys{};
+        std::array<node_*, 4> children{};
+    };
+
+    struct node16_ : node_
+    {
+        node16_() : node_{ node_type_::node16 } {}
+
+        alignas(16) std::array<uint8_t, 16> keys{};
+        std::array<node_*, 16> children{};
+    };
+
+    struct node48_ : node_
+    {
+        node48_() : node_{ node_type_::node48 } {}
+
+        // 0 means no child, otherwise the child is children[index - 1].
+        std::array<uint8_t, 256> index{};
+        std::array<node_*, 48> children{};
+    };
+
+    struct node256_ : node_
+    {
+        node256_() : node_{ node_type_::node256 } {}
+
+        std::array<node_*, 256> children{};
+    };
+
+public:
+    radix_index() = default;
+    radix_index(const radix_index&) = delete;
+    radix_index& operator=(const radix_index&) = delete;
+    radix_index(radix_index&& other) noexcept
+        : root_(std::exchange(other.root_, nullptr)), size_(std::exchange(other.size_, 0))
+    {
+    }
+    radix_index& operator=(radix_index&& other) noexcept
+    {
+        if (this != &other)
+        {
+            clear();
+            root_ = std::exchange(other.root_, nullptr);
+            size_ = std::exchange(other.size_, 0);
+        }
+        return *this;
+    }
+    ~radix_index() { clear(); }
+
+    inline std::size_t size() const { return size_; }
+    inline bool empty() const { return size_ == 0; }
+
+    inline void clear()
+    {
+        destroy_(root_);
+        root_ = nullptr;
+        size_ = 0;
+    }
+
+    /**
+     * @brief Insert a value if the key is not present.
+     * @return A pointer to the value mapped to the key, and true if the insertion took place.
+     */
+    std::pair<Value*, bool> insert(const key_type& key, Value value)
+    {
+        node_** ref = &root_;
+        for (std::size_t depth = 0;; ++depth)
+        {
+            node_* node = *ref;
+            if (node == nullptr)
+            {
+                leaf_* leaf = new leaf_(key, std::move(value));
+                *ref = leaf;
+                ++size_;
+                return { &leaf->value, true };
+            }
+            if (node->type == node_type_::leaf)
+            {
+                leaf_* old_leaf = static_cast<leaf_*>(node);
+                if (old_leaf->key == key)
+                    return { &old_leaf->value, false };
+                return { &expand_leaf_(ref, old_leaf, depth, key, std::move(value))->value, true };
+            }
+            const uint8_t byte = byte_(key, depth);
+            node_** child_ref = find_child_(node, byte);
+            if (child_ref == nullptr)
+            {
+                // The leaf is owned until it is linked: growing the node may throw.
+                std::unique_ptr<leaf_> leaf = std::make_unique<leaf_>(key, std::move(value));
+                add_child_(ref, byte, leaf.get());
+                ++size_;
+                return { &leaf.release()->value, true };
+            }
+            ref = child_ref;
+        }
+    }
+
+    /**
+     * @brief Insert a value, or assign it if the key is already present.
+     * @return true if the insertion took place, false if the assignment took place.
+     */
+    inline bool insert_or_assign(const key_type& key, Value value)
+    {
+        if (Value* value_ptr = find(key))
+        {
+            *value_ptr = std::move(value);
+            return false;
+        }
+        insert(key, std::move(value));
+        return true;
+    }
+
+    inline Value* find(const key_type& key) { return const_cast<Value*>(std::as_const(*this).find(key)); }
+
+    const Value* find(const key_type& key) const
+    {
+        const node_* node = root_;
+        for (std::size_t depth = 0; node != nullptr; ++depth)
+        {
+            if (node->type == node_type_::leaf)
+            {
+                const leaf_* leaf = static_cast<const leaf_*>(node);
+                return leaf->key == key ? &leaf->value : nullptr;
+            }
+            node_* const* child_ref = find_child_(const_cast<node_*>(node), byte_(key, depth));
+            node = child_ref ? *child_ref : nullptr;
+        }
+        return nullptr;
+    }
+
+    inline bool contains(const key_type& key) const { return find(key) != nullptr; }
+
+    /**
+     * @brief Visit every (key, value) pair in alphabetical key order.
+     */
+    template <class Function>
+    inline void for_each(Function&& function) const
+    {
+        visit_(root_, [&](const leaf_& leaf) { function(leaf.key, leaf.value); });
+    }
+
+    template <class Function>
+    inline void for_each(Function&& function)
+    {
+        visit_(root_, [&](const leaf_& leaf) { function(leaf.key, const_cast<Value&>(leaf.value)); });
+    }
+
+    /**
+     * @brief Visit, in alphabetical order, every (key, value) pair whose key starts with prefix.
+     */
+    template <class Function>
+    void prefix_scan(std::string_view prefix, Function&& function) const
+    {
+        if (prefix.length() > key_type::max_length())
+            return;
+        const node_* node = root_;
+        std::size_t depth = 0;
+        for (; node != nullptr && depth < prefix.length(); ++depth)
+        {
+            if (node->type == node_type_::leaf)
+                break;
+            node_* const* child_ref = find_child_(const_cast<node_*>(node), static_cast<uint8_t>(prefix[depth]));
+            node = child_ref ? *child_ref : nullptr;
+        }
+        visit_(node, [&](const leaf_& leaf) {
+            if (leaf.key.to_string_view().starts_with(prefix))
+                function(leaf.key, leaf.value);
+        });
+    }
+
+    /**
+     * @brief Visit, in alphabetical order, every (key, value) pair whose key is in [first, last).
+     */
+    template <class Function>
+    inline void range_scan(const key_type& first, const key_type& last, Function&& function) const
+    {
+        const uint64_t first_order = order_key_(first), last_order = order_key_(last);
+        if (first_order < last_order)
+            range_visit_(root_, 0, first, last, true, true, [&](const leaf_& leaf) {
+                const uint64_t order = order_key_(leaf.key);
+                if (first_order <= order && order < last_order)
+                    function(leaf.key, leaf.value);
+            });
+    }
+
+private:
+    inline static uint8_t byte_(const key_type& key, std::size_t index)
+    {
+        return static_cast<uint8_t>(key.begin()[index]);
+    }
+
+    // Big-endian integer of the key bytes: its integer order is the alphabetical order.
+    inline static uint64_t order_key_(const key_type& key)
+    {
+        uint64_t order = 0;
+        for (std::size_t i = 0; i < key_size_; ++i)
+            order = (order << 8) | byte_(key, i);
+        return order;
+    }
+
+    inline static unsigned node16_find_(const node16_& node, uint8_t byte)
+    {
+#ifdef ARBA_STRN_RADIX_INDEX_SSE2
+        const __m128i keys = _mm_load_si128(reinterpret_cast<const __m128i*>(node.keys.data()));
+        const __m128i equal = _mm_cmpeq_epi8(keys, _mm_set1_epi8(static_cast<char>(byte)));
+        const unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(equal)) & ((1u << node.count) - 1);
+        return mask ? std::countr_zero(mask) : node.count;
+#else
+        const auto end_iter = node.keys.begin() + node.count;
+        return static_cast<unsigned>(std::find(node.keys.begin(), end_iter, byte) - node.keys.begin());
+#endif
+    }
+
+    // Position of the first stored byte greater than byte (keys are sorted).
+    inline static unsigned node16_upper_bound_(const node16_& node, uint8_t byte)
+    {
+#ifdef ARBA_STRN_RADIX_INDEX_SSE2
+        const __m128i bias = _mm_set1_epi8(static_cast<char>(0x80));
+        const __m128i keys = _mm_xor_si128(_mm_load_si128(reinterpret_cast<const __m128i*>(node.keys.data())), bias);
+        const __m128i value = _mm_xor_si128(_mm_set1_epi8(static_cast<char>(byte)), bias);
+        const unsigned mask
+            = static_cast<unsigned>(_mm_movemask_epi8(_mm_cmplt_epi8(value, keys))) & ((1u << node.count) - 1);
+        return mask ? std::countr_zero(mask) : node.count;
+#else
+        const auto end_iter = node.keys.begin() + node.count;
+        return static_cast<unsigned>(std::upper_bound(node.keys.begin(), end_iter, byte) - node.keys.begin());
+#endif
+    }
+
+    static node_** find_child_(node_* node, uint8_t byte)
+    {
+        switch (node->type)
+        {
+        case node_type_::node4:
+        {
+            node4_* n4 = static_cast<node4_*>(node);
+            for (unsigned i = 0; i < n4->count; ++i)
+                if (n4->keys[i] == byte)
+                    return &n4->children[i];
+            return nullptr;
+        }
+        case node_type_::node16:
+        {
+            node16_* n16 = static_cast<node16_*>(node);
+            const unsigned i = node16_find_(*n16, byte);
+            return i < n16->count ? &n16->children[i] : nullptr;
+        }
+        case node_type_::node48:
+        {
+            node48_* n48 = static_cast<node48_*>(node);
+            const uint8_t slot = n48->index[byte];
+            return slot ? &n48->children[slot - 1] : nullptr;
+        }
+        case node_type_::node256:
+        {
+            node256_* n256 = static_cast<node256_*>(node);
+            return n256->children[byte] ? &n256->children[byte] : nullptr;
+        }
+        default:
+            return nullptr;
+        }
+    }
+
+    template <class Node>
+    inline static void sorted_insert_(Node& node, uint8_t byte, node_* child, unsigned position)
+    {
+        std::copy_backward(node.keys.begin() + position, node.keys.begin() + node.count,
+                           node.keys.begin() + node.count + 1);
+        std::copy_backward(node.children.begin() + position, node.children.begin() + node.count,
+                           node.children.begin() + node.count + 1);
+        node.keys[position] = byte;
+        node.children[position] = child;
+        ++node.count;
+    }
+
+    struct subtree_deleter_
+    {
+        inline void operator()(node_* node) const { destroy_(node); }
+    };
+
+    using subtree_ptr_ = std::unique_ptr<node_, subtree_deleter_>;
+
+    // Replace the leaf *ref by one node4 per byte it shares with key from depth on, then a node4 holding both leaves.
+    // The new nodes are built off the tree, so that if an allocation throws, the tree is left unchanged.
+    leaf_* expand_leaf_(node_** ref, leaf_* old_leaf, std::size_t depth, const key_type& key, Value&& value)
+    {
+        std::size_t split_depth = depth;
+        while (byte_(old_leaf->key, split_depth) == byte_(key, split_depth))
+            ++split_depth;
+        std::unique_ptr<leaf_> leaf = std::make_unique<leaf_>(key, std::move(value));
+        subtree_ptr_ subtree(new node4_());
+        node_* split_node = subtree.get();
+        // Adding to a node4 with room never throws.
+        add_child_(&split_node, byte_(key, split_depth), leaf.get());
+        leaf_* new_leaf = leaf.release();
+        for (std::size_t index = split_depth; index > depth; --index)
+        {
+            subtree_ptr_ parent(new node4_());
+            node_* parent_node = parent.get();
+            add_child_(&parent_node, byte_(key, index - 1), subtree.get());
+            subtree.release();
+            subtree = std::move(parent);
+        }
+        add_child_(&split_node, byte_(old_leaf->key, split_depth), old_leaf);
+        *ref = subtree.release();
+        ++size_;
+        return new_leaf;
+    }
+
+    // Add a child to the inner node *ref, growing (and replacing) the node if it is full.
+    static void add_child_(node_** ref, uint8_t byte, node_* child)
+    {
+        node_* node = *ref;
+        switch (node->type)
+        {
+        case node_type_::node4:
+        {
+            node4_* n4 = static_cast<node4_*>(node);
+            if (n4->count < 4)
+            {
+                unsigned position = 0;
+                while (position < n4->count && n4->keys[position] < byte)
+                    ++position;
+                sorted_insert_(*n4, byte, child, position);
+                return;
+            }
+            node16_* n16 = new node16_();
+            std::copy(n4->keys.begin(), n4->keys.end(), n16->keys.begin());
+            std::copy(n4->children.begin(), n4->children.end(), n16->children.begin());
+            n16->count = n4->count;
+            delete n4;
+            *ref = n16;
+            [[fallthrough]];
+        }
+        case node_type_::node16:
+        {
+            node16_* n16 = static_cast<node16_*>(*ref);
+            if (n16->count < 16)
+            {
+                sorted_insert_(*n16, byte, child, node16_upper_bound_(*n16, byte));
+                return;
+            }
+            node48_* n48 = new node48_();
+            for (unsigned i = 0; i < n16->count; ++i)
+            {
+                n48->index[n16->keys[i]] = static_cast<uint8_t>(i + 1);
+                n48->children[i] = n16->children[i];
+            }
+            n48->count = n16->count;
+            delete n16;
+            *ref = n48;
+            [[fallthrough]];
+        }
+        case node_type_::node48:
+        {
+            node48_* n48 = static_cast<node48_*>(*ref);
+            if (n48->count < 48)
+            {
+                n48->children[n48->count] = child;
+                n48->index[byte] = static_cast<uint8_t>(++n48->count);
+                return;
+            }
+            node256_* n256 = new node256_();
+            for (unsigned b = 0; b < 256; ++b)
+                if (n48->index[b])
+                    n256->children[b] = n48->children[n48->index[b] - 1];
+            n256->count = n48->count;
+            delete n48;
+            *ref = n256;
+            [[fallthrough]];
+        }
+        case node_type_::node256:
+        {
+            node256_* n256 = static_cast<node256_*>(*ref);
+            n256->children[byte] = child;
+            ++n256->count;
+            return;
+        }
+        default:
+            return;
+        }
+    }
+
+    // Call function(byte, child) for every child of an inner node, in increasing byte order.
+    template <class Function>
+    static void for_each_child_(const node_* node, Function&& function)
+    {
+        switch (node->type)
+        {
+        case node_type_::node4:
+        {
+            const node4_* n4 = static_cast<const node4_*>(node);
+            for (unsigned i = 0; i < n4->count; ++i)
+                function(n4->keys[i], n4->children[i]);
+            break;
+        }
+        case node_type_::node16:
+        {
+            const node16_* n16 = static_cast<const node16_*>(node);
+            for (unsigned i = 0; i < n16->count; ++i)
+                function(n16->keys[i], n16->children[i]);
+            break;
+        }
+        case node_type_::node48:
+        {
+            const node48_* n48 = static_cast<const node48_*>(node);
+            for (unsigned b = 0; b < 256; ++b)
+                if (n48->index[b])
+                    function(static_cast<uint8_t>(b), n48->children[n48->index[b] - 1]);
+            break;
+        }
+        case node_type_::node256:
+        {
+            const node256_* n256 = static_cast<const node256_*>(node);
+            for (unsigned b = 0; b < 256; ++b)
+                if (n256->children[b])
+                    function(static_cast<uint8_t>(b), n256->children[b]);
+            break;
+        }
+        default:
+            break;
+        }
+    }
+
+    template <class Function>
+    static void visit_(const node_* node, Function&& function)
+    {
+        if (node == nullptr)
+            return;
+        if (node->type == node_type_::leaf)
+            function(*static_cast<const leaf_*>(node));
+        else
+            for_each_child_(node, [&](uint8_t, const node_* child) { visit_(child, function); });
+    }
+
+    // Visit the subtrees which may hold keys in [first, last]: the leaves still have to be checked.
+    template <class Function>
+    static void range_visit_(const node_* node, std::size_t depth, const key_type& first, const key_type& last,
+                             bool first_bound, bool last_bound, Function&& function)
+    {
+        if (node == nullptr)
+            return;
+        if (node->type == node_type_::leaf || (!first_bound && !last_bound))
+        {
+            visit_(node, function);
+            return;
+        }
+        const uint8_t first_byte = byte_(first, depth), last_byte = byte_(last, depth);
+        for_each_child_(node, [&](uint8_t byte, const node_* child) {
+            if ((first_bound && byte < first_byte) || (last_bound && byte > last_byte))
+                return;
+            range_visit_(child, depth + 1, first, last, first_bound && byte == first_byte,
+                         last_bound && byte == last_byte, function);
+        });
+    }
+
+    static void destroy_(node_* node)
+    {
+        if (node == nullptr)
+            return;
+        switch (node->type)
+        {
+        case node_type_::leaf:
+            delete static_cast<leaf_*>(node);
+            return;
+        case node_type_::node4:
+            for_each_child_(node, [](uint8_t, node_* child) { destroy_(child); });
+            delete static_cast<node4_*>(node);
+            return;
+        case node_type_::node16:
+            for_each_child_(node, [](uint8_t, node_* child) { destroy_(child); });
+            delete static_cast<node16_*>(node);
+            return;
+        case node_type_::node48:
+            for_each_child_(node, [](uint8_t, node_* child) { destroy_(child); });
+            delete static_cast<node48_*>(node);
+            return;
+        case node_type_::node256:
+            for_each_child_(node, [](uint8_t, node_* child) { destroy_(child); });
+            delete static_cast<node256_*>(node);
+            return;
+        }
+    }
+
+private:
+    node_* root_ = nullptr;
+    std::size_t size_ = 0;
+};
+
+} // namespace strn
+} // namespace arba
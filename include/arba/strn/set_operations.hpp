@@ -0,0 +1,333 @@
+#pragma once
+
+#include "string_n_traits.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <span>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+inline namespace arba
+{
+namespace strn
+{
+
+// The inputs of the set operations are sorted by the string-N operator< (the integer order, as std::sort sorts them),
+// without duplicates.
+
+class set_operations_
+{
+    template <string_n StringN>
+    friend std::size_t set_intersection(std::span<const StringN>, std::span<const StringN>, std::span<StringN>);
+    template <string_n StringN>
+    friend std::size_t set_union(std::span<const StringN>, std::span<const StringN>, std::span<StringN>);
+    template <string_n StringN>
+    friend std::size_t set_difference(std::span<const StringN>, std::span<const StringN>, std::span<StringN>);
+    template <string_n StringN, class Callback>
+    friend void merge_join(std::span<const StringN>, std::span<const StringN>, Callback&&);
+
+    // Galloping is used when an input is at least gallop_ratio_ times larger than the other one.
+    inline constexpr static std::size_t gallop_ratio_ = 32;
+
+    inline static bool skewed_(std::size_t small_size, std::size_t large_size)
+    {
+        return large_size / gallop_ratio_ >= small_size;
+    }
+
+    // The first element of [first, last) not less than key, searched with growing steps from first.
+    template <string_n StringN>
+    inline static const StringN* gallop_(const StringN* first, const StringN* last, const StringN& key)
+    {
+        const std::size_t size = static_cast<std::size_t>(last - first);
+        std::size_t bound = 1;
+        while (bound < size && first[bound] < key)
+            bound *= 2;
+        return std::lower_bound(first + bound / 2, first + std::min(bound + 1, size), key);
+    }
+
+#if defined(__AVX2__)
+    template <string_n StringN>
+    inline constexpr static std::size_t lanes_ = sizeof(__m256i) / sizeof(StringN);
+
+    // Bit k is set if lhs[k] is equal to one of rhs[0, lanes_): lhs is compared with every rotation of rhs.
+    template <string_n StringN>
+    inline static unsigned match_mask_(const StringN* lhs, const StringN* rhs)
+    {
+        static_assert(sizeof(StringN) == sizeof(typename StringN::uint));
+        constexpr int dwords = sizeof(StringN) / sizeof(uint32_t);
+        const __m256i rotation = _mm256_setr_epi32(dwords % 8, (1 + dwords) % 8, (2 + dwords) % 8, (3 + dwords) % 8,
+                                                   (4 + dwords) % 8, (5 + dwords) % 8, (6 + dwords) % 8,
+                                                   (7 + dwords) % 8);
+        const __m256i lhs_v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(lhs));
+        __m256i rhs_v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(rhs));
+        __m256i equal = _mm256_setzero_si256();
+        for (std::size_t r = 0; r < lanes_<StringN>; ++r)
+        {
+            if constexpr (sizeof(StringN) == sizeof(uint64_t))
+                equal = _mm256_or_si256(equal, _mm256_cmpeq_epi64(lhs_v, rhs_v));
+            else
+                equal = _mm256_or_si256(equal, _mm256_cmpeq_epi32(lhs_v, rhs_v));
+            rhs_v = _mm256_permutevar8x32_epi32(rhs_v, rotation);
+        }
+        if constexpr (sizeof(StringN) == sizeof(uint64_t))
+            return static_cast<unsigned>(_mm256_movemask_pd(_mm256_castsi256_pd(equal)));
+        else
+            return static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(equal)));
+    }
+#endif
+};
+
+/**
+ * @brief Write the values present in both lhs and rhs.
+ * @param lhs, rhs The sorted inputs, without duplicates.
+ * @param out The output, of size min(lhs.size(), rhs.size()) at least.
+ * @return The number of written values.
+ *
+ * Similar-sized inputs are compared by blocks of 256 bits with AVX2 (every value of a block of lhs against every
+ * value of a block of rhs), then with a merge loop without branch. If an input is at least 32 times larger, each
+ * value of the smaller one is searched in the larger one by galloping.
+ *
+ * std::vector<strn::string64> common(std::min(universe.size(), subscriptions.size()));
+ * common.resize(strn::set_intersection<strn::string64>(universe, subscriptions, common));
+ */
+template <string_n StringN>
+std::size_t set_intersection(std::span<const StringN> lhs, std::span<const StringN> rhs, std::span<StringN> out)
+{
+    if (lhs.size() > rhs.size())
+        std::swap(lhs, rhs);
+    const StringN* a = lhs.data();
+    const StringN* b = rhs.data();
+    const std::size_t a_size = lhs.size(), b_size = rhs.size();
+    std::size_t count = 0;
+
+    if (set_operations_::skewed_(a_size, b_size))
+    {
+        const StringN* b_iter = b;
+        for (std::size_t i = 0; i < a_size; ++i)
+        {
+            b_iter = set_operations_::gallop_(b_iter, b + b_size, a[i]);
+            if (b_iter == b + b_size)
+                break;
+            out[count] = a[i];
+            count += *b_iter == a[i];
+        }
+        return count;
+    }
+
+    std::size_t i = 0, j = 0;
+#if defined(__AVX2__)
+    constexpr std::size_t lanes = set_operations_::lanes_<StringN>;
+    while (i + lanes <= a_size && j + lanes <= b_size)
+    {
+        for (unsigned mask = set_operations_::match_mask_(a + i, b + j); mask != 0; mask &= mask - 1)
+            out[count++] = a[i + std::countr_zero(mask)];
+        const StringN a_max = a[i + lanes - 1], b_max = b[j + lanes - 1];
+        i += lanes * !(b_max < a_max);
+        j += lanes * !(a_max < b_max);
+    }
+#endif
+    while (i < a_size && j < b_size)
+    {
+        const StringN x = a[i], y = b[j];
+        out[count] = x;
+        count += x == y;
+        i += !(y < x);
+        j += !(x < y);
+    }
+    return count;
+}
+
+/**
+ * @brief Write the values present in lhs or rhs, in order.
+ * @param lhs, rhs The sorted inputs, without duplicates.
+ * @param out The output, of size lhs.size() + rhs.size() at least.
+ * @return The number of written values.
+ *
+ * The merge loop has no branch; if an input is at least 32 times larger, the runs of the larger one between the
+ * values of the smaller one are found by galloping and copied.
+ */
+template <string_n StringN>
+std::size_t set_union(std::span<const StringN> lhs, std::span<const StringN> rhs, std::span<StringN> out)
+{
+    if (lhs.size() > rhs.size())
+        std::swap(lhs, rhs);
+    const StringN* a = lhs.data();
+    const StringN* b = rhs.data();
+    const std::size_t a_size = lhs.size(), b_size = rhs.size();
+    std::size_t count = 0, i = 0, j = 0;
+
+    if (set_operations_::skewed_(a_size, b_size))
+    {
+        for (; i < a_size; ++i)
+        {
+            const StringN* b_iter = set_operations_::gallop_(b + j, b + b_size, a[i]);
+            count = std::copy(b + j, b_iter, out.begin() + count) - out.begin();
+            j = static_cast<std::size_t>(b_iter - b);
+            out[count++] = a[i];
+            j += j < b_size && b[j] == a[i];
+        }
+    }
+    else
+    {
+        while (i < a_size && j < b_size)
+        {
+            const StringN x = a[i], y = b[j];
+            const bool take_x = !(y < x);
+            out[count++] = take_x ? x : y;
+            i += take_x;
+            j += !(x < y);
+        }
+        count = std::copy(a + i, a + a_size, out.begin() + count) - out.begin();
+    }
+    return std::copy(b + j, b + b_size, out.begin() + count) - out.begin();
+}
+
+/**
+ * @brief Write the values of lhs which are not in rhs.
+ * @param lhs, rhs The sorted inputs, without duplicates.
+ * @param out The output, of size lhs.size() at least.
+ * @return The number of written values.
+ *
+ * Like set_intersection(), similar-sized inputs are compared by blocks with AVX2, then merged without branch, and
+ * skewed inputs are galloped.
+ */
+template <string_n StringN>
+std::size_t set_difference(std::span<const StringN> lhs, std::span<const StringN> rhs, std::span<StringN> out)
+{
+    const StringN* a = lhs.data();
+    const StringN* b = rhs.data();
+    const std::size_t a_size = lhs.size(), b_size = rhs.size();
+    std::size_t count = 0, i = 0, j = 0;
+
+    if (set_operations_::skewed_(a_size, b_size))
+    {
+        const StringN* b_iter = b;
+        for (; i < a_size; ++i)
+        {
+            b_iter = set_operations_::gallop_(b_iter, b + b_size, a[i]);
+            out[count] = a[i];
+            count += b_iter == b + b_size || !(*b_iter == a[i]);
+        }
+        return count;
+    }
+    if (set_operations_::skewed_(b_size, a_size))
+    {
+        for (; j < b_size; ++j)
+        {
+            const StringN* a_iter = set_operations_::gallop_(a + i, a + a_size, b[j]);
+            count = std::copy(a + i, a_iter, out.begin() + count) - out.begin();
+            i = static_cast<std::size_t>(a_iter - a);
+            i += i < a_size && a[i] == b[j];
+        }
+        return std::copy(a + i, a + a_size, out.begin() + count) - out.begin();
+    }
+
+#if defined(__AVX2__)
+    constexpr std::size_t lanes = set_operations_::lanes_<StringN>;
+    // The values of the current block of lhs found in the blocks of rhs compared so far.
+    unsigned matched = 0;
+    while (i + lanes <= a_size && j + lanes <= b_size)
+    {
+        matched |= set_operations_::match_mask_(a + i, b + j);
+        const StringN a_max = a[i + lanes - 1], b_max = b[j + lanes - 1];
+        if (!(b_max < a_max))
+        {
+            for (std::size_t k = 0; k < lanes; ++k)
+            {
+                out[count] = a[i + k];
+                count += !((matched >> k) & 1);
+            }
+            matched = 0;
+            i += lanes;
+        }
+        j += lanes * !(a_max < b_max);
+    }
+    // The values of the current block less than b[j] were compared with all their candidates.
+    for (std::size_t k = 0; k < lanes && i < a_size && (j == b_size || a[i] < b[j]); ++k, ++i)
+    {
+        out[count] = a[i];
+        count += !((matched >> k) & 1);
+    }
+#endif
+    while (i < a_size && j < b_size)
+    {
+        const StringN x = a[i], y = b[j];
+        out[count] = x;
+        count += x < y;
+        i += !(y < x);
+        j += !(x < y);
+    }
+    return std::copy(a + i, a + a_size, out.begin() + count) - out.begin();
+}
+
+/**
+ * @brief Call a function for each value present in both lhs and rhs.
+ * @param lhs, rhs The sorted inputs, without duplicates.
+ * @param callback Called as callback(lhs_index, rhs_index) for each pair of equal values, in order.
+ *
+ * The inputs are compared like in set_intersection(), so the positions of the values can index their payloads:
+ *
+ * strn::merge_join<strn::string64>(universe, subscriptions, [&](std::size_t i, std::size_t j) { ... });
+ */
+template <string_n StringN, class Callback>
+void merge_join(std::span<const StringN> lhs, std::span<const StringN> rhs, Callback&& callback)
+{
+    const bool swapped = lhs.size() > rhs.size();
+    if (swapped)
+        std::swap(lhs, rhs);
+    const auto call = [&](std::size_t a_index, std::size_t b_index) {
+        if (swapped)
+            callback(b_index, a_index);
+        else
+            callback(a_index, b_index);
+    };
+    const StringN* a = lhs.data();
+    const StringN* b = rhs.data();
+    const std::size_t a_size = lhs.size(), b_size = rhs.size();
+
+    if (set_operations_::skewed_(a_size, b_size))
+    {
+        const StringN* b_iter = b;
+        for (std::size_t i = 0; i < a_size; ++i)
+        {
+            b_iter = set_operations_::gallop_(b_iter, b + b_size, a[i]);
+            if (b_iter == b + b_size)
+                break;
+            if (*b_iter == a[i])
+                call(i, static_cast<std::size_t>(b_iter - b));
+        }
+        return;
+    }
+
+    std::size_t i = 0, j = 0;
+#if defined(__AVX2__)
+    constexpr std::size_t lanes = set_operations_::lanes_<StringN>;
+    while (i + lanes <= a_size && j + lanes <= b_size)
+    {
+        for (unsigned mask = set_operations_::match_mask_(a + i, b + j); mask != 0; mask &= mask - 1)
+        {
+            const std::size_t a_index = i + std::countr_zero(mask);
+            const std::size_t b_index = std::find(b + j, b + j + lanes, a[a_index]) - b;
+            call(a_index, b_index);
+        }
+        const StringN a_max = a[i + lanes - 1], b_max = b[j + lanes - 1];
+        i += lanes * !(b_max < a_max);
+        j += lanes * !(a_max < b_max);
+    }
+#endif
+    while (i < a_size && j < b_size)
+    {
+        const StringN x = a[i], y = b[j];
+        if (x == y)
+            call(i, j);
+        i += !(y < x);
+        j += !(x < y);
+    }
+}
+
+} // namespace strn
+} // namespace arba
@@ -0,0 +1,224 @@
+#pragma once
+
+#include "detail/cache_line.hpp"
+#include "detail/parallel.hpp"
+#include "flat_hash_map.hpp"
+#include "hash_policy.hpp"
+#include "string_n_traits.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <utility>
+
+inline namespace arba
+{
+namespace strn
+{
+
+/**
+ * @brief The sharded_map class is a thread-safe hash map whose keys are string-N values, split in Shards
+ * flat_hash_map tables each guarded by its own reader-writer lock.
+ *
+ * The shard of a key is taken from the low bits of one mum_mix() of integer(), the slot in the shard table from the
+ * high bits: threads working on different keys rarely share a lock. Each shard sits on its own cache lines, so that
+ * locking one shard never invalidates the cache line of another one.
+ *
+ * The values are never exposed outside of a lock: find() returns a copy, visit() and update() run a function under
+ * the lock of the shard.
+ *
+ * strn::sharded_map<strn::string64, double> prices;
+ * prices.insert_or_assign("AAPL"_s64, 189.5);
+ * std::optional<double> price = prices.find("AAPL"_s64);
+ */
+template <string_n Key, class Value, std::size_t Shards = 64>
+class sharded_map
+{
+    static_assert(std::has_single_bit(Shards), "sharded_map shard count must be a power of two.");
+
+public:
+    using key_type = Key;
+    using mapped_type = Value;
+    using table_type = flat_hash_map<Key, Value, mum_hash>;
+
+private:
+    struct alignas(detail::cache_line_size) shard_
+    {
+        mutable std::shared_mutex mutex;
+        table_type table;
+    };
+
+public:
+    inline constexpr static std::size_t shard_count() { return Shards; }
+
+    /**
+     * @brief sharded_map
+     * @param expected_size The number of keys the map is sized for: each shard is sized for its share.
+     */
+    explicit sharded_map(std::size_t expected_size = 0)
+    {
+        for (shard_& shard : shards_)
+            shard.table.reserve(expected_size / Shards);
+    }
+
+    sharded_map(const sharded_map&) = delete;
+    sharded_map& operator=(const sharded_map&) = delete;
+
+    /**
+     * @brief The number of keys. The shards are counted one after the other, so concurrent writes may be partially
+     * counted.
+     */
+    std::size_t size() const
+    {
+        std::size_t size = 0;
+        for (const shard_& shard : shards_)
+        {
+            std::shared_lock lock(shard.mutex);
+            size += shard.table.size();
+        }
+        return size;
+    }
+
+    inline bool empty() const { return size() == 0; }
+
+    void clear()
+    {
+        for (shard_& shard : shards_)
+        {
+            std::unique_lock lock(shard.mutex);
+            shard.table.clear();
+        }
+    }
+
+    /**
+     * @brief Insert a value if the key is not present.
+     * @return true if the insertion took place.
+     */
+    bool insert(const key_type& key, Value value)
+    {
+        shard_& shard = shard_of_(key);
+        std::unique_lock lock(shard.mutex);
+        return shard.table.insert(key, std::move(value)).second;
+    }
+
+    /**
+     * @brief Insert a value, or assign it if the key is already present.
+     * @return true if the insertion took place, false if the assignment took place.
+     */
+    bool insert_or_assign(const key_type& key, Value value)
+    {
+        shard_& shard = shard_of_(key);
+        std::unique_lock lock(shard.mutex);
+        return shard.table.insert_or_assign(key, std::move(value));
+    }
+
+    bool erase(const key_type& key)
+    {
+        shard_& shard = shard_of_(key);
+        std::unique_lock lock(shard.mutex);
+        return shard.table.erase(key);
+    }
+
+    /**
+     * @brief A copy of the value mapped to the key, or std::nullopt if the key is not present.
+     */
+    std::optional<Value> find(const key_type& key) const
+    {
+        const shard_& shard = shard_of_(key);
+        std::shared_lock lock(shard.mutex);
+        if (const Value* value = shard.table.find(key))
+            return *value;
+        return std::nullopt;
+    }
+
+    inline bool contains(const key_type& key) const { return visit(key, [](const Value&) {}); }
+
+    /**
+     * @brief Call function(value) with the value mapped to the key, under a shared lock of its shard.
+     * @return true if the key is present.
+     */
+    template <class Function>
+    bool visit(const key_type& key, Function&& function) const
+    {
+        const shard_& shard = shard_of_(key);
+        std::shared_lock lock(shard.mutex);
+        const Value* value = shard.table.find(key);
+        if (value)
+            function(*value);
+        return value != nullptr;
+    }
+
+    /**
+     * @brief Call function(value) with the value mapped to the key (inserted as Value() if the key is not present),
+     * under an exclusive lock of its shard.
+     *
+     * volumes.update("AAPL"_s64, [&](uint64_t& volume) { volume += quantity; });
+     */
+    template <class Function>
+    void update(const key_type& key, Function&& function)
+    {
+        shard_& shard = shard_of_(key);
+        std::unique_lock lock(shard.mutex);
+        function(shard.table[key]);
+    }
+
+    /**
+     * @brief Call function(table) for each shard table, the shards being spread over threads. Each call holds a
+     * shared lock of its shard.
+     * @param thread_count The maximal number of threads, 0 for std::thread::hardware_concurrency().
+     *
+     * The first exception thrown by function is rethrown once all the threads have returned: the shards left to a
+     * thread after it threw are not visited.
+     */
+    template <class Function>
+    void for_each_shard(Function&& function, std::size_t thread_count = 0) const
+    {
+        for_each_shard_(shards_, thread_count, [&function](const shard_& shard) {
+            std::shared_lock lock(shard.mutex);
+            function(std::as_const(shard.table));
+        });
+    }
+
+    /**
+     * @brief Call function(table) for each shard table, the shards being spread over threads. Each call holds an
+     * exclusive lock of its shard.
+     */
+    template <class Function>
+    void for_each_shard(Function&& function, std::size_t thread_count = 0)
+    {
+        for_each_shard_(shards_, thread_count, [&function](shard_& shard) {
+            std::unique_lock lock(shard.mutex);
+            function(shard.table);
+        });
+    }
+
+private:
+    inline static std::size_t shard_index_(const key_type& key)
+    {
+        // The shard tables index their slots with the high bits of the same mix.
+        return static_cast<std::size_t>(mum_mix(key.integer()) & (Shards - 1));
+    }
+
+    inline shard_& shard_of_(const key_type& key) { return shards_[shard_index_(key)]; }
+    inline const shard_& shard_of_(const key_type& key) const { return shards_[shard_index_(key)]; }
+
+    template <class ShardArray, class Visit>
+    static void for_each_shard_(ShardArray& shards, std::size_t thread_count, const Visit& visit)
+    {
+        const std::size_t count = std::min(detail::thread_count(thread_count), Shards);
+        detail::run_parallel(count, [&](std::size_t thread_index) {
+            for (std::size_t i = thread_index; i < Shards; i += count)
+                visit(shards[i]);
+        });
+    }
+
+private:
+    std::array<shard_, Shards> shards_;
+};
+
+} // namespace strn
+} // namespace arba
@@ -0,0 +1,257 @@
+#pragma once
+
+#include "detail/cache_line.hpp"
+#include "flat_hash_map.hpp"
+#include "string_n_traits.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+inline namespace arba
+{
+namespace strn
+{
+
+/**
+ * @brief The snapshot_map class is a map whose keys are string-N values, read without locks and updated by
+ * publishing a new immutable table (read-copy-update).
+ *
+ * A thread reads through a reader, which owns one slot of the map. Opening a view stores the current epoch in the
+ * slot and loads the current table: no loop, no lock, and no write to a cache line shared with another thread. A
+ * writer copies the current table, modifies the copy and swaps it in. The old table is freed once every open view
+ * is of a later epoch. Writers are serialized by a mutex.
+ *
+ * It suits registries read far more often than written: a write copies the whole table.
+ *
+ * strn::snapshot_map<strn::string64, handler_type> handlers;
+ * handlers.insert_or_assign("ORDER"_s64, on_order);
+ * auto reader = handlers.make_reader(); // once per thread
+ * if (const handler_type* handler = reader.snapshot().find("ORDER"_s64)) ...
+ */
+template <string_n Key, class Value>
+class snapshot_map
+{
+public:
+    using key_type = Key;
+    using mapped_type = Value;
+    using table_type = flat_hash_map<Key, Value>;
+
+private:
+    // The epoch of a slot with no open view.
+    inline constexpr static uint64_t idle_ = 0;
+
+    struct alignas(detail::cache_line_size) reader_slot_
+    {
+        std::atomic<uint64_t> epoch = idle_;
+        std::atomic<bool> used = false;
+    };
+
+public:
+    class reader;
+
+    /**
+     * @brief A table pinned by a reader: the table stays alive and unchanged until the view is destroyed, whatever
+     * the writers do meanwhile.
+     */
+    class view
+    {
+    public:
+        view(const view&) = delete;
+        view& operator=(const view&) = delete;
+        inline ~view() { reader_->unpin_(); }
+
+        inline const table_type& table() const { return *table_; }
+        inline const Value* find(const key_type& key) const { return table_->find(key); }
+        inline bool contains(const key_type& key) const { return table_->contains(key); }
+        inline std::size_t size() const { return table_->size(); }
+        inline bool empty() const { return table_->empty(); }
+
+    private:
+        friend class reader;
+
+        inline view(reader& owner) : reader_(&owner), table_(owner.pin_()) {}
+
+        reader* reader_;
+        const table_type* table_;
+    };
+
+    /**
+     * @brief The handle through which a thread reads the map. A reader is used by one thread at a time, and must
+     * be destroyed before the map. It is returned by make_reader() and cannot be moved.
+     */
+    class reader
+    {
+    public:
+        // Not movable: the views of a reader point to it.
+        reader(const reader&) = delete;
+        reader& operator=(const reader&) = delete;
+
+        inline ~reader() { slot_->used.store(false, std::memory_order_release); }
+
+        /**
+         * @brief Pin the current table. Views of the same reader may be nested: they all see the table of the
+         * outermost one.
+         */
+        inline view snapshot() { return view(*this); }
+
+        /**
+         * @brief A copy of the value mapped to the key in the current table, or std::nullopt if the key is not
+         * present.
+         */
+        inline std::optional<Value> find(const key_type& key)
+        {
+            const view pinned = snapshot();
+            if (const Value* value = pinned.find(key))
+                return *value;
+            return std::nullopt;
+        }
+
+    private:
+        friend class snapshot_map;
+        friend class view;
+
+        inline reader(const snapshot_map& map, reader_slot_& slot) : map_(&map), slot_(&slot) {}
+
+        inline const table_type* pin_()
+        {
+            if (depth_++ == 0)
+            {
+                // Publish the epoch before loading the table: a writer seeing the slot idle has swapped the table
+                // before this load (both are sequentially consistent), so the load gets the new table.
+                slot_->epoch.store(map_->epoch_.load(std::memory_order_seq_cst), std::memory_order_seq_cst);
+                pinned_ = map_->current_.load(std::memory_order_seq_cst);
+            }
+            return pinned_;
+        }
+
+        inline void unpin_()
+        {
+            if (--depth_ == 0)
+                slot_->epoch.store(idle_, std::memory_order_release);
+        }
+
+        const snapshot_map* map_;
+        reader_slot_* slot_;
+        const table_type* pinned_ = nullptr;
+        std::size_t depth_ = 0;
+    };
+
+    /**
+     * @brief snapshot_map
+     * @param max_readers The maximal number of readers alive at the same time.
+     */
+    explicit snapshot_map(std::size_t max_readers = 64)
+        : slots_(std::make_unique<reader_slot_[]>(max_readers)), slot_count_(max_readers),
+          current_owner_(std::make_unique<const table_type>())
+    {
+        current_.store(current_owner_.get());
+    }
+
+    snapshot_map(const snapshot_map&) = delete;
+    snapshot_map& operator=(const snapshot_map&) = delete;
+
+    /**
+     * @brief Claim a reader slot.
+     * @throw std::runtime_error If max_readers readers are already alive.
+     */
+    reader make_reader() const
+    {
+        for (std::size_t i = 0; i < slot_count_; ++i)
+        {
+            bool used = false;
+            if (slots_[i].used.compare_exchange_strong(used, true, std::memory_order_acquire))
+                return reader(*this, slots_[i]);
+        }
+        throw std::runtime_error("strn::snapshot_map: no free reader slot.");
+    }
+
+    inline std::size_t max_readers() const { return slot_count_; }
+
+    /**
+     * @brief Publish a new table.
+     */
+    void assign(table_type table)
+    {
+        std::lock_guard lock(writer_mutex_);
+        publish_(std::make_unique<const table_type>(std::move(table)));
+    }
+
+    /**
+     * @brief Publish a modified copy of the current table: function(table) is called with the copy.
+     *
+     * registry.update([](auto& table) { table.erase("OLD"_s64); table.insert_or_assign("NEW"_s64, 2); });
+     */
+    template <class Function>
+    void update(Function&& function)
+    {
+        std::lock_guard lock(writer_mutex_);
+        auto table = std::make_unique<table_type>(*current_owner_);
+        function(*table);
+        publish_(std::move(table));
+    }
+
+    inline void insert_or_assign(const key_type& key, Value value)
+    {
+        update([&](table_type& table) { table.insert_or_assign(key, std::move(value)); });
+    }
+
+    inline void erase(const key_type& key)
+    {
+        update([&](table_type& table) { table.erase(key); });
+    }
+
+    /**
+     * @brief The number of replaced tables not freed yet, because a view may still be reading them.
+     */
+    std::size_t retired_count() const
+    {
+        std::lock_guard lock(writer_mutex_);
+        return retired_.size();
+    }
+
+private:
+    struct retired_table_
+    {
+        uint64_t epoch;
+        std::unique_ptr<const table_type> table;
+    };
+
+    void publish_(std::unique_ptr<const table_type> table)
+    {
+        current_.store(table.get(), std::memory_order_seq_cst);
+        // A view opened at this epoch or later cannot see the old table.
+        const uint64_t epoch = epoch_.fetch_add(1, std::memory_order_seq_cst) + 1;
+        retired_.push_back(retired_table_{ epoch, std::exchange(current_owner_, std::move(table)) });
+        reclaim_();
+    }
+
+    void reclaim_()
+    {
+        uint64_t oldest = std::numeric_limits<uint64_t>::max();
+        for (std::size_t i = 0; i < slot_count_; ++i)
+            if (const uint64_t epoch = slots_[i].epoch.load(std::memory_order_seq_cst); epoch != idle_)
+                oldest = std::min(oldest, epoch);
+        std::erase_if(retired_, [oldest](const retired_table_& retired) { return retired.epoch <= oldest; });
+    }
+
+private:
+    std::unique_ptr<reader_slot_[]> slots_;
+    std::size_t slot_count_;
+    alignas(detail::cache_line_size) std::atomic<const table_type*> current_;
+    std::atomic<uint64_t> epoch_ = 1;
+    // The fields below are only used by the writers.
+    alignas(detail::cache_line_size) mutable std::mutex writer_mutex_;
+    std::unique_ptr<const table_type> current_owner_;
+    std::vector<retired_table_> retired_;
+};
+
+} // namespace strn
+} // namespace arba
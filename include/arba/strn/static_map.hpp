@@ -0,0 +1,255 @@
+#pragma once
+
+#include "string_n_traits.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+inline namespace arba
+{
+namespace strn
+{
+
+template <string_n Key, class Value, std::size_t Size, std::size_t Capacity, std::size_t BucketCount>
+class static_map;
+
+/**
+ * @brief The layout of a static_map: its table capacity, its bucket count and the seed of its hash.
+ */
+struct static_map_layout
+{
+    std::size_t capacity;
+    std::size_t bucket_count;
+    uint64_t seed;
+};
+
+// The hash of a static_map has two levels (like CHD or PTHash): the high bits of key.integer() * seed select a bucket,
+// then the slot of the key is taken from the high bits of ((key.integer() * seed) ^ pilot) * slot_multiplier_, where
+// pilot is searched at build time for each bucket so that no two keys share a slot.
+class static_map_builder_
+{
+    template <class PairsFunction>
+    friend consteval auto make_static_map(PairsFunction);
+    template <string_n Key, class Value, std::size_t Size, std::size_t Capacity, std::size_t BucketCount>
+    friend class static_map;
+
+    inline constexpr static std::size_t min_capacity_ = 8;
+    inline constexpr static std::size_t min_bucket_count_ = 2;
+    // The average number of keys per bucket.
+    inline constexpr static std::size_t bucket_size_ = 4;
+    // The capacity starts at the power of two above 1.25 * size, and may be doubled twice.
+    inline constexpr static std::size_t capacity_doublings_ = 2;
+    inline constexpr static std::size_t seed_tries_ = 16;
+    inline constexpr static uint64_t pilot_tries_ = uint64_t(1) << 16;
+    inline constexpr static uint64_t slot_multiplier_ = 0xbf58476d1ce4e5b9ull;
+
+    inline constexpr static uint64_t splitmix64_(uint64_t& state)
+    {
+        uint64_t value = (state += 0x9e3779b97f4a7c15ull);
+        value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9ull;
+        value = (value ^ (value >> 27)) * 0x94d049bb133111ebull;
+        return value ^ (value >> 31);
+    }
+
+    inline constexpr static unsigned shift_of_(std::size_t count)
+    {
+        return static_cast<unsigned>(64 - std::countr_zero(count));
+    }
+
+    inline constexpr static uint64_t mixed_key_(uint64_t integer, uint64_t seed) { return integer * seed; }
+
+    inline constexpr static std::size_t slot_of_(uint64_t mixed_key, uint64_t pilot, unsigned slot_shift)
+    {
+        return static_cast<std::size_t>(((mixed_key ^ pilot) * slot_multiplier_) >> slot_shift);
+    }
+
+    // Search a pilot for each bucket, the biggest buckets first while most slots are free.
+    // Return false if a bucket has no pilot placing its keys in free slots.
+    template <class Pairs>
+    consteval static bool assign_pilots_(const Pairs& pairs, const static_map_layout& layout, uint64_t* pilots)
+    {
+        const std::size_t size = pairs.size();
+        const unsigned bucket_shift = shift_of_(layout.bucket_count);
+        const unsigned slot_shift = shift_of_(layout.capacity);
+        std::vector<uint64_t> mixed_keys(size);
+        std::vector<std::vector<std::size_t>> buckets(layout.bucket_count);
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            mixed_keys[i] = mixed_key_(pairs[i].first.integer(), layout.seed);
+            buckets[mixed_keys[i] >> bucket_shift].push_back(i);
+        }
+        std::vector<std::size_t> order(layout.bucket_count);
+        for (std::size_t bucket = 0; bucket < order.size(); ++bucket)
+            order[bucket] = bucket;
+        std::sort(order.begin(), order.end(), [&buckets](std::size_t lhs, std::size_t rhs) {
+            return buckets[lhs].size() != buckets[rhs].size() ? buckets[lhs].size() > buckets[rhs].size() : lhs < rhs;
+        });
+
+        std::vector<bool> taken(layout.capacity, false);
+        std::vector<std::size_t> slots;
+        for (std::size_t bucket : order)
+        {
+            uint64_t state = bucket;
+            bool placed = false;
+            for (uint64_t try_number = 0; try_number < pilot_tries_ && !placed; ++try_number)
+            {
+                const uint64_t pilot = splitmix64_(state);
+                slots.clear();
+                placed = true;
+                for (std::size_t i : buckets[bucket])
+                {
+                    const std::size_t slot = slot_of_(mixed_keys[i], pilot, slot_shift);
+                    if (taken[slot] || std::find(slots.begin(), slots.end(), slot) != slots.end())
+                    {
+                        placed = false;
+                        break;
+                    }
+                    slots.push_back(slot);
+                }
+                if (placed)
+                {
+                    pilots[bucket] = pilot;
+                    for (std::size_t slot : slots)
+                        taken[slot] = true;
+                }
+            }
+            if (!placed)
+                return false;
+        }
+        return true;
+    }
+
+    template <class Pairs>
+    consteval static static_map_layout search_layout_(const Pairs& pairs)
+    {
+        const std::size_t size = pairs.size();
+        std::vector<uint64_t> integers(size);
+        for (std::size_t i = 0; i < size; ++i)
+            integers[i] = pairs[i].first.integer();
+        std::sort(integers.begin(), integers.end());
+        if (std::adjacent_find(integers.begin(), integers.end()) != integers.end())
+            throw "strn::make_static_map: duplicate key";
+        const std::size_t bucket_count = std::bit_ceil(std::max(min_bucket_count_, size / bucket_size_));
+        const std::size_t first_capacity = std::bit_ceil(std::max(min_capacity_, size + size / 4));
+        std::vector<uint64_t> pilots(bucket_count);
+        for (std::size_t capacity = first_capacity; capacity <= (first_capacity << capacity_doublings_); capacity *= 2)
+        {
+            uint64_t state = capacity;
+            for (std::size_t try_number = 0; try_number < seed_tries_; ++try_number)
+            {
+                const static_map_layout layout{ capacity, bucket_count, splitmix64_(state) | 1 };
+                if (assign_pilots_(pairs, layout, pilots.data()))
+                    return layout;
+            }
+        }
+        throw "strn::make_static_map: no collision-free layout found (capacity limit reached)";
+    }
+};
+
+/**
+ * @brief The static_map class is an immutable hash map of string-N keys, built at compile time by make_static_map().
+ *
+ * Its hash has two levels, searched at compile time so that no two keys share a slot: a multiply-shift selects a
+ * bucket and its pilot, then a second multiply-shift of the key mixed with the pilot gives the slot. A lookup is two
+ * multiplies, one pilot load and one key compare, with no probing and no branch tree. The empty slots hold a key of
+ * the map whose own slot is elsewhere, so the compare alone tells whether the key is present.
+ *
+ * The table has the power-of-two capacity above 1.25 * size (512 slots for 300 keys), and there is one pilot per 4
+ * keys. Keys and values are stored in two arrays, so that the lookup of an absent key reads the keys only.
+ */
+template <string_n Key, class Value, std::size_t Size, std::size_t Capacity, std::size_t BucketCount>
+class static_map
+{
+public:
+    using key_type = Key;
+    using mapped_type = Value;
+
+    inline constexpr static std::size_t size() { return Size; }
+    inline constexpr static bool empty() { return Size == 0; }
+    inline constexpr static std::size_t capacity() { return Capacity; }
+    inline constexpr static std::size_t bucket_count() { return BucketCount; }
+    inline constexpr uint64_t seed() const { return seed_; }
+
+    inline constexpr const Value* find(const key_type& key) const
+    {
+        const uint64_t mixed_key = builder_::mixed_key_(key.integer(), seed_);
+        const std::size_t index = builder_::slot_of_(mixed_key, pilots_[mixed_key >> bucket_shift_], slot_shift_);
+        return keys_[index] == key ? &values_[index] : nullptr;
+    }
+
+    inline constexpr bool contains(const key_type& key) const { return find(key) != nullptr; }
+
+    /**
+     * @brief Get the value mapped to a key, or a default value if the key is not present.
+     */
+    inline constexpr Value value_or(const key_type& key, Value default_value) const
+    {
+        const Value* value = find(key);
+        return value ? *value : default_value;
+    }
+
+private:
+    template <class PairsFunction>
+    friend consteval auto make_static_map(PairsFunction);
+
+    using builder_ = static_map_builder_;
+
+    static_assert(std::has_single_bit(Capacity) && std::has_single_bit(BucketCount) && BucketCount > 1);
+    inline constexpr static unsigned slot_shift_ = builder_::shift_of_(Capacity);
+    inline constexpr static unsigned bucket_shift_ = builder_::shift_of_(BucketCount);
+
+    constexpr static_map() = default;
+
+private:
+    std::array<Key, Capacity> keys_;
+    std::array<Value, Capacity> values_{};
+    std::array<uint64_t, BucketCount> pilots_{};
+    uint64_t seed_ = 0;
+};
+
+/**
+ * @brief Build a static_map at compile time.
+ * @param pairs_function A lambda without capture returning a std::array of (key, value) pairs.
+ * The keys must be distinct, there must be at least one, and they must be built in a constant expression.
+ *
+ * constexpr auto tags = strn::make_static_map([] {
+ *     return std::array{ std::pair{ "NEW"_s64, 1 }, std::pair{ "CANCEL"_s64, 2 } };
+ * });
+ * if (const int* tag = tags.find(type)) { ... }
+ */
+template <class PairsFunction>
+consteval auto make_static_map(PairsFunction)
+{
+    constexpr auto pairs = PairsFunction{}();
+    using key_type = typename decltype(pairs)::value_type::first_type;
+    using mapped_type = typename decltype(pairs)::value_type::second_type;
+    static_assert(string_n<key_type>, "The keys of a static_map must be string-N values.");
+    static_assert(pairs.size() > 0, "A static_map needs at least one key.");
+    constexpr static_map_layout layout = static_map_builder_::search_layout_(pairs);
+
+    static_map<key_type, mapped_type, pairs.size(), layout.capacity, layout.bucket_count> map;
+    map.seed_ = layout.seed;
+    static_map_builder_::assign_pilots_(pairs, layout, map.pilots_.data());
+    std::array<bool, layout.capacity> occupied{};
+    for (const auto& [key, value] : pairs)
+    {
+        const uint64_t mixed_key = static_map_builder_::mixed_key_(key.integer(), layout.seed);
+        const std::size_t index
+            = static_map_builder_::slot_of_(mixed_key, map.pilots_[mixed_key >> map.bucket_shift_], map.slot_shift_);
+        map.keys_[index] = key;
+        map.values_[index] = value;
+        occupied[index] = true;
+    }
+    // Fill the empty slots with the first key, whose slot is elsewhere, so that a lookup never matches them.
+    for (std::size_t index = 0; index < layout.capacity; ++index)
+        if (!occupied[index])
+            map.keys_[index] = pairs[0].first;
+    return map;
+}
+
+} // namespace strn
+} // namespace arba
@@ -0,0 +1,110 @@
+#pragma once
+
+#include "config.hpp"
+#include "string_n_traits.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+inline namespace arba
+{
+namespace strn
+{
+/**
+ * @brief Opt-in instrumentation counters.
+ *
+ * The counters are compiled in only if ARBA_STRN_STATS is defined (CMake option ARBA_STRN_STATS). Otherwise the
+ * recording functions are empty and snapshot() returns zeros. The counters are shared by all threads (relaxed
+ * atomics): they are meant to measure production data, not to stay enabled in the hottest builds.
+ */
+namespace stats
+{
+#ifdef ARBA_STRN_STATS
+inline constexpr bool enabled = true;
+#else
+inline constexpr bool enabled = false;
+#endif
+
+enum class string_type : uint8_t
+{
+    string32,
+    string56,
+    string64,
+};
+
+template <string_n StringN>
+inline constexpr string_type string_type_v = std::is_same_v<std::remove_cv_t<StringN>, string32>   ? string_type::string32
+                                             : std::is_same_v<std::remove_cv_t<StringN>, string56> ? string_type::string56
+                                                                                                   : string_type::string64;
+
+enum class container : uint8_t
+{
+    flat_hash_map,
+    mapped_table,
+};
+
+/// The last bucket of a length histogram counts the lengths greater than or equal to it.
+inline constexpr std::size_t length_histogram_size = 33;
+/// Bucket i of a probe histogram counts the lookups which examined i + 1 slots, the last one all the longer lookups.
+inline constexpr std::size_t probe_histogram_size = 16;
+
+/**
+ * @brief Counters of a string type, for the values built from runtime text (constructors from a string_view, a
+ * std::string or a C string, from_view(), from_views(), token_reader) and for the literals evaluated at runtime.
+ */
+struct string_type_counters
+{
+    uint64_t constructed = 0;
+    /// Values built from text longer than max_length().
+    uint64_t truncated = 0;
+    /// Literals too long for the type, which were evaluated at runtime and gave "#BAD_..." values.
+    uint64_t bad_literals = 0;
+    /// The lengths of the input texts, before truncation.
+    std::array<uint64_t, length_histogram_size> length_histogram{};
+};
+
+struct container_counters
+{
+    uint64_t lookups = 0;
+    /// The total number of slots examined.
+    uint64_t probes = 0;
+    std::array<uint64_t, probe_histogram_size> probe_histogram{};
+};
+
+struct counters
+{
+    string_type_counters string32;
+    string_type_counters string56;
+    string_type_counters string64;
+    container_counters flat_hash_map;
+    container_counters mapped_table;
+};
+
+/**
+ * @brief A copy of the current counters.
+ */
+counters snapshot();
+
+/**
+ * @brief Set all the counters to zero.
+ */
+void reset();
+
+#ifdef ARBA_STRN_STATS
+void record_construction(string_type type, std::size_t input_length);
+void record_bad_literal(string_type type);
+void record_probes(container type, std::size_t probes);
+#else
+inline constexpr void record_construction(string_type, std::size_t) {}
+inline constexpr void record_bad_literal(string_type) {}
+inline constexpr void record_probes(container, std::size_t) {}
+#endif
+
+} // namespace stats
+} // namespace strn
+} // namespace arba
+
+#ifdef ARBA_STRN_HEADER_ONLY
+#include "impl/stats.hpp"
+#endif
@@ -1,9 +1,14 @@
 #pragma once
 
 #include "c_str_traits.hpp"
+#include "config.hpp"
+#include "stats.hpp"
+#include "string_n_cast.hpp"
+#include "string_n_formatter.hpp"
 #include "string_n_helper.hpp"
 
 #include <array>
+#include <bit>
 #include <cstring>
 #include <format>
 #include <functional>
@@ -47,11 +52,11 @@ public:
     /**
      * @brief string56
      */
-    constexpr explicit string56() : integer_(0) {}
+    constexpr explicit string56() : cstr_{} {}
 
     template <class Enum>
         requires is_enum56_v<Enum>
-    constexpr explicit string56(Enum value) : integer_(static_cast<string56::uint>(value))
+    constexpr explicit string56(Enum value) : cstr_(std::bit_cast<buffer_type_>(static_cast<uint>(value)))
     {
     }
 
@@ -67,6 +72,8 @@ public:
         size_t str_len = std::min<std::size_t>(max_length(), str.length());
         cstr_.back() = str_len;
         std::copy(str.begin(), str.begin() + str_len, cstr_.begin());
+        if (!std::is_constant_evaluated())
+            stats::record_construction(stats::string_type::string56, str.length());
     }
 
     /**
@@ -119,11 +126,29 @@ public:
     {
     }
 
-    constexpr const uint& integer() const { return integer_; }
-    constexpr std::size_t hash() const { return static_cast<std::size_t>(integer_); }
+    /**
+     * @brief Convert a value of another string-N type, keeping its first max_length() characters.
+     * @param str The value to convert.
+     *
+     * See string_n_cast() to know whether characters were dropped.
+     */
+    template <string_n StringN>
+        requires(!std::is_same_v<StringN, string56>)
+    constexpr explicit string56(const StringN& str) : string56(string_n_cast<string56>(str))
+    {
+    }
+
+    /**
+     * @brief Build a string56 from its integer representation.
+     * @param value A value previously returned by integer().
+     */
+    constexpr static string56 from_integer(uint value) { return string56(value); }
+
+    constexpr uint integer() const { return std::bit_cast<uint>(cstr_); }
+    constexpr std::size_t hash() const { return static_cast<std::size_t>(integer()); }
     constexpr std::string_view to_string_view() const { return std::string_view(cstr_.data(), length()); }
     constexpr std::string to_string() const { return std::string(begin(), end()); }
-    constexpr bool empty() const { return integer_ == 0; }
+    constexpr bool empty() const { return integer() == 0; }
     constexpr bool not_empty() const { return !empty(); }
     constexpr std::size_t length() const { return cstr_.back(); }
     constexpr static std::size_t max_length() { return buffer_size_ - 1; }
@@ -136,19 +161,41 @@ public:
     bool is_printable() const;
     constexpr const char& operator[](std::size_t index) const { return cstr_[index]; }
     constexpr char& operator[](std::size_t index) { return cstr_[index]; }
-    constexpr bool operator==(const string56& rhs) const { return integer_ == rhs.integer_; }
-    constexpr bool operator!=(const string56& rhs) const { return integer_ != rhs.integer_; }
-    constexpr bool operator<(const string56& rhs) const { return integer_ < rhs.integer_; }
-    void push_back(const char& ch);
-    void pop_back();
-    inline void clear() { integer_ = 0; }
-    void resize(std::size_t new_length, char new_ch = char());
+    constexpr bool operator==(const string56& rhs) const { return integer() == rhs.integer(); }
+    constexpr bool operator!=(const string56& rhs) const { return integer() != rhs.integer(); }
+    constexpr bool operator<(const string56& rhs) const { return integer() < rhs.integer(); }
+    constexpr void push_back(const char& ch);
+    constexpr void pop_back();
+    constexpr void clear() { cstr_ = buffer_type_{}; }
+    /**
+     * @brief Remove the characters from index on, if any.
+     */
+    constexpr void clear_from(std::size_t index);
+    constexpr void resize(std::size_t new_length, char new_ch = char());
+    /**
+     * @brief Append the characters of str with one shift and one or.
+     * @param str The characters to append.
+     * @param policy What to do if the characters of str do not all fit.
+     * @return false if the characters of str did not all fit.
+     */
+    constexpr bool append(const string56& str, overflow_policy policy = overflow_policy::truncate);
+
+    /**
+     * @brief Concatenate two values, truncating the result to max_length() characters.
+     *
+     * strn::string56 key = "XN"_s56 + suffix;
+     */
+    inline friend constexpr string56 operator+(string56 lhs, const string56& rhs)
+    {
+        lhs.append(rhs);
+        return lhs;
+    }
 
     template <class Enum>
         requires is_enum56_v<Enum>
     inline constexpr Enum to_enum()
     {
-        return static_cast<Enum>(integer_);
+        return static_cast<Enum>(integer());
     }
 
 private:
@@ -159,44 +206,73 @@ private:
     {
         if (len <= max_length())
         {
-            uint value = 0;
-            static_assert(std::endian::native == std::endian::little || std::endian::native == std::endian::big);
-            if constexpr (std::endian::native == std::endian::little)
-            {
-                for (uint8_t i = 0; i < len; ++i)
-                {
-                    uint vi = static_cast<std::size_t>(cstr[i]);
-                    vi <<= (8 * i);
-                    value |= vi;
-                }
-                value |= (len <<= 56);
-            }
-            else
-            {
-                for (uint8_t i = 0, last_i = len - 1; i < len; ++i)
-                {
-                    uint vi = static_cast<std::size_t>(cstr[i]);
-                    vi <<= (8 * (last_i - i));
-                    value |= vi;
-                }
-                value |= (len <<= 56);
-            }
-            return string56(value);
+            string56 str;
+            std::copy(cstr, cstr + len, str.cstr_.begin());
+            str.cstr_.back() = static_cast<value_type>(len);
+            return str;
         }
+        if (!std::is_constant_evaluated())
+            stats::record_bad_literal(stats::string_type::string56);
         return "#BADs56"_s56;
     }
 
-    constexpr explicit string56(uint value) : integer_(value) {}
+    constexpr explicit string56(uint value) : cstr_(std::bit_cast<buffer_type_>(value)) {}
 
-private:
-    union
+    // The length byte holding length, in the integer representation.
+    inline constexpr static uint length_unit_(std::size_t length)
     {
-        buffer_type_ cstr_;
-        uint integer_;
-    };
+        return static_cast<uint>(length) << string_n_helper::byte_shift_<uint>(max_length());
+    }
+
+private:
+    // The characters, in memory order: integer() is their bit_cast, so every operation is usable in constant
+    // expressions and the value can live in a register.
+    alignas(uint) buffer_type_ cstr_;
 };
 static_assert(sizeof(string56::uint) == sizeof(uint64_t));
 static_assert(sizeof(string56) == sizeof(string56::uint));
+static_assert(alignof(string56) == alignof(string56::uint));
+
+constexpr void string56::push_back(const char& ch)
+{
+    const std::size_t length = this->length();
+    const uint value = string_n_helper::push_back_(integer(), length, max_length(), ch);
+    cstr_ = std::bit_cast<buffer_type_>(value + length_unit_(length < max_length()));
+}
+
+constexpr void string56::pop_back()
+{
+    const std::size_t length = this->length();
+    const uint value = string_n_helper::pop_back_(integer(), length);
+    cstr_ = std::bit_cast<buffer_type_>(value - length_unit_(length != 0));
+}
+
+constexpr void string56::resize(std::size_t new_length, char new_ch)
+{
+    new_length = std::min(new_length, max_length());
+    const uint value = string_n_helper::resize_(integer(), length(), new_length, new_ch);
+    cstr_ = std::bit_cast<buffer_type_>(value | length_unit_(new_length));
+}
+
+constexpr void string56::clear_from(std::size_t index)
+{
+    const std::size_t new_length = std::min(index, length());
+    const uint value = integer() & string_n_helper::prefix_mask_<uint>(new_length);
+    cstr_ = std::bit_cast<buffer_type_>(value | length_unit_(new_length));
+}
+
+constexpr bool string56::append(const string56& str, overflow_policy policy)
+{
+    const std::size_t length = this->length();
+    const bool fits = length + str.length() <= max_length();
+    const std::size_t new_length = std::min(length + str.length(), max_length());
+    const uint chars = str.integer() & string_n_helper::prefix_mask_<uint>(max_length());
+    const uint appended
+        = string_n_helper::append_chars_(chars, length, max_length()) | length_unit_(new_length - length);
+    const uint mask = string_n_helper::condition_mask_<uint>(fits || policy == overflow_policy::truncate);
+    cstr_ = std::bit_cast<buffer_type_>(integer() + (appended & mask));
+    return fits;
+}
 
 // Literals
 
@@ -231,11 +307,11 @@ struct std::hash<arba::strn::string56>
  * @brief The std::formatter<::arba::strn::string56> struct specialization
  */
 template <class CharT>
-struct std::formatter<::arba::strn::string56, CharT> : public std::formatter<std::string_view, CharT>
+struct std::formatter<::arba::strn::string56, CharT>
+    : public ::arba::strn::string_n_formatter<::arba::strn::string56, CharT>
 {
-    template <class FormatContext>
-    auto format(const ::arba::strn::string56& str, FormatContext& ctx) const
-    {
-        return std::formatter<std::string_view, CharT>::format(str.to_string_view(), ctx);
-    }
 };
+
+#ifdef ARBA_STRN_HEADER_ONLY
+#include "impl/string56.hpp"
+#endif
@@ -1,9 +1,14 @@
 #pragma once
 
 #include "c_str_traits.hpp"
+#include "config.hpp"
+#include "stats.hpp"
+#include "string_n_cast.hpp"
+#include "string_n_formatter.hpp"
 #include "string_n_helper.hpp"
 
 #include <array>
+#include <bit>
 #include <cstring>
 #include <format>
 #include <functional>
@@ -47,11 +52,11 @@ public:
     /**
      * @brief string64
      */
-    constexpr explicit string64() : integer_(0) {}
+    constexpr explicit string64() : cstr_{} {}
 
     template <class Enum>
         requires is_enum64_v<Enum>
-    constexpr explicit string64(Enum value) : integer_(static_cast<string64::uint>(value))
+    constexpr explicit string64(Enum value) : cstr_(std::bit_cast<buffer_type_>(static_cast<uint>(value)))
     {
     }
 
@@ -65,6 +70,8 @@ public:
     constexpr explicit string64(const std::string_view& str) : string64()
     {
         std::copy(str.begin(), str.begin() + std::min<std::size_t>(buffer_size_, str.length()), cstr_.begin());
+        if (!std::is_constant_evaluated())
+            stats::record_construction(stats::string_type::string64, str.length());
     }
 
     /**
@@ -117,13 +124,31 @@ public:
     {
     }
 
-    constexpr const uint& integer() const { return integer_; }
-    constexpr std::size_t hash() const { return static_cast<std::size_t>(integer_); }
+    /**
+     * @brief Convert a value of another string-N type, keeping its first max_length() characters.
+     * @param str The value to convert.
+     *
+     * See string_n_cast() to know whether characters were dropped.
+     */
+    template <string_n StringN>
+        requires(!std::is_same_v<StringN, string64>)
+    constexpr explicit string64(const StringN& str) : string64(string_n_cast<string64>(str))
+    {
+    }
+
+    /**
+     * @brief Build a string64 from its integer representation.
+     * @param value A value previously returned by integer().
+     */
+    constexpr static string64 from_integer(uint value) { return string64(value); }
+
+    constexpr uint integer() const { return std::bit_cast<uint>(cstr_); }
+    constexpr std::size_t hash() const { return static_cast<std::size_t>(integer()); }
     constexpr std::string_view to_string_view() const { return std::string_view(cstr_.data(), length()); }
     constexpr std::string to_string() const { return std::string(begin(), end()); }
-    constexpr bool empty() const { return integer_ == 0; }
+    constexpr bool empty() const { return integer() == 0; }
     constexpr bool not_empty() const { return !empty(); }
-    constexpr std::size_t length() const { return string_n_helper::string64_length_(integer_); }
+    constexpr std::size_t length() const { return string_n_helper::string64_length_(integer()); }
     constexpr static std::size_t max_length() { return buffer_size_; }
     constexpr const_iterator begin() const { return cstr_.begin(); }
     constexpr iterator begin() { return cstr_.begin(); }
@@ -134,19 +159,41 @@ public:
     bool is_printable() const;
     constexpr const char& operator[](std::size_t index) const { return cstr_[index]; }
     constexpr char& operator[](std::size_t index) { return cstr_[index]; }
-    constexpr bool operator==(const string64& rhs) const { return integer_ == rhs.integer_; }
-    constexpr bool operator!=(const string64& rhs) const { return integer_ != rhs.integer_; }
-    constexpr bool operator<(const string64& rhs) const { return integer_ < rhs.integer_; }
-    void push_back(const char& ch);
-    void pop_back();
-    inline void clear() { integer_ = 0; }
-    void resize(std::size_t new_length, char new_ch = char());
+    constexpr bool operator==(const string64& rhs) const { return integer() == rhs.integer(); }
+    constexpr bool operator!=(const string64& rhs) const { return integer() != rhs.integer(); }
+    constexpr bool operator<(const string64& rhs) const { return integer() < rhs.integer(); }
+    constexpr void push_back(const char& ch);
+    constexpr void pop_back();
+    constexpr void clear() { cstr_ = buffer_type_{}; }
+    /**
+     * @brief Remove the characters from index on, if any.
+     */
+    constexpr void clear_from(std::size_t index);
+    constexpr void resize(std::size_t new_length, char new_ch = char());
+    /**
+     * @brief Append the characters of str with one shift and one or.
+     * @param str The characters to append.
+     * @param policy What to do if the characters of str do not all fit.
+     * @return false if the characters of str did not all fit.
+     */
+    constexpr bool append(const string64& str, overflow_policy policy = overflow_policy::truncate);
+
+    /**
+     * @brief Concatenate two values, truncating the result to max_length() characters.
+     *
+     * strn::string64 key = "XN"_s64 + suffix;
+     */
+    inline friend constexpr string64 operator+(string64 lhs, const string64& rhs)
+    {
+        lhs.append(rhs);
+        return lhs;
+    }
 
     template <class Enum>
         requires is_enum64_v<Enum>
     inline constexpr Enum to_enum()
     {
-        return static_cast<Enum>(integer_);
+        return static_cast<Enum>(integer());
     }
 
 private:
@@ -157,42 +204,57 @@ private:
     {
         if (len <= max_length())
         {
-            uint value = 0;
-            static_assert(std::endian::native == std::endian::little || std::endian::native == std::endian::big);
-            if constexpr (std::endian::native == std::endian::little)
-            {
-                for (uint8_t i = 0; i < len; ++i)
-                {
-                    uint vi = static_cast<std::size_t>(cstr[i]);
-                    vi <<= (8 * i);
-                    value |= vi;
-                }
-            }
-            else
-            {
-                for (uint8_t i = 0, last_i = len - 1; i < len; ++i)
-                {
-                    uint vi = static_cast<std::size_t>(cstr[i]);
-                    vi <<= (8 * (last_i - i));
-                    value |= vi;
-                }
-            }
-            return string64(value);
+            string64 str;
+            std::copy(cstr, cstr + len, str.cstr_.begin());
+            return str;
         }
+        if (!std::is_constant_evaluated())
+            stats::record_bad_literal(stats::string_type::string64);
         return "#BAD_S64"_s64;
     }
 
-    constexpr explicit string64(uint value) : integer_(value) {}
+    constexpr explicit string64(uint value) : cstr_(std::bit_cast<buffer_type_>(value)) {}
 
 private:
-    union
-    {
-        buffer_type_ cstr_;
-        uint integer_;
-    };
+    // The characters, in memory order: integer() is their bit_cast, so every operation is usable in constant
+    // expressions and the value can live in a register.
+    alignas(uint) buffer_type_ cstr_;
 };
 static_assert(sizeof(string64::uint) == sizeof(uint64_t));
 static_assert(sizeof(string64) == sizeof(string64::uint));
+static_assert(alignof(string64) == alignof(string64::uint));
+
+constexpr void string64::push_back(const char& ch)
+{
+    cstr_ = std::bit_cast<buffer_type_>(string_n_helper::push_back_(integer(), length(), max_length(), ch));
+}
+
+constexpr void string64::pop_back()
+{
+    cstr_ = std::bit_cast<buffer_type_>(string_n_helper::pop_back_(integer(), length()));
+}
+
+constexpr void string64::resize(std::size_t new_length, char new_ch)
+{
+    new_length = std::min(new_length, max_length());
+    cstr_ = std::bit_cast<buffer_type_>(string_n_helper::resize_(integer(), length(), new_length, new_ch));
+}
+
+constexpr void string64::clear_from(std::size_t index)
+{
+    index = std::min(index, max_length());
+    cstr_ = std::bit_cast<buffer_type_>(integer() & string_n_helper::prefix_mask_<uint>(index));
+}
+
+constexpr bool string64::append(const string64& str, overflow_policy policy)
+{
+    const std::size_t length = this->length();
+    const bool fits = length + str.length() <= max_length();
+    const uint appended = string_n_helper::append_chars_(str.integer(), length, max_length());
+    const uint mask = string_n_helper::condition_mask_<uint>(fits || policy == overflow_policy::truncate);
+    cstr_ = std::bit_cast<buffer_type_>(integer() | (appended & mask));
+    return fits;
+}
 
 // Literals
 
@@ -227,11 +289,11 @@ struct std::hash<arba::strn::string64>
  * @brief The std::formatter<::arba::strn::string64> struct specialization
  */
 template <class CharT>
-struct std::formatter<::arba::strn::string64, CharT> : public std::formatter<std::string_view, CharT>
+struct std::formatter<::arba::strn::string64, CharT>
+    : public ::arba::strn::string_n_formatter<::arba::strn::string64, CharT>
 {
-    template <class FormatContext>
-    auto format(const ::arba::strn::string64& str, FormatContext& ctx) const
-    {
-        return std::formatter<std::string_view, CharT>::format(str.to_string_view(), ctx);
-    }
 };
+
+#ifdef ARBA_STRN_HEADER_ONLY
+#include "impl/string64.hpp"
+#endif
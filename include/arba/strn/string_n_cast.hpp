@@ -0,0 +1,117 @@
+#pragma once
+
+#include "string_n_helper.hpp"
+#include "string_n_traits.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <type_traits>
+
+inline namespace arba
+{
+namespace strn
+{
+
+/**
+ * @brief What to do with a string_view longer than the string-N maximal length.
+ */
+enum class truncation_policy : uint8_t
+{
+    truncate, ///< Keep the first max_length() characters (like the string_view constructors).
+    clear,    ///< Produce an empty string-N.
+};
+
+/**
+ * @brief What to do when appended characters do not fit in a string-N value.
+ */
+enum class overflow_policy : uint8_t
+{
+    truncate, ///< Append the characters which fit.
+    saturate, ///< Append all the characters or none.
+    optional, ///< Like saturate, but concat() returns std::nullopt instead of the characters which fit.
+};
+
+class string_n_caster_
+{
+    template <string_n To, string_n From>
+    friend constexpr To string_n_cast(const From& str, truncation_policy policy, bool& truncated);
+    template <string_n Lhs, string_n Rhs>
+        requires(!std::is_same_v<Lhs, Rhs>)
+    friend constexpr bool operator==(const Lhs& lhs, const Rhs& rhs);
+
+    template <string_n StringN>
+    inline constexpr static bool stores_length_ = StringN::max_length() < sizeof(typename StringN::uint);
+
+    // The characters of str, character i in the byte of index i of a uint64_t (in memory order), without the length
+    // byte of a string56.
+    template <string_n StringN>
+    inline constexpr static uint64_t chars_(const StringN& str)
+    {
+        uint64_t chars = str.integer();
+        if constexpr (std::endian::native == std::endian::big)
+            chars <<= 8 * (sizeof(uint64_t) - sizeof(typename StringN::uint));
+        if constexpr (stores_length_<StringN>)
+            chars &= string_n_helper::prefix_mask_<uint64_t>(StringN::max_length());
+        return chars;
+    }
+
+    template <string_n To, string_n From>
+    inline constexpr static To cast_(const From& str, truncation_policy policy, bool& truncated)
+    {
+        using uint = typename To::uint;
+        uint64_t chars = chars_(str);
+        std::size_t length = str.length();
+        truncated = false;
+        if constexpr (To::max_length() < From::max_length())
+        {
+            truncated = length > To::max_length();
+            if (truncated && policy == truncation_policy::clear)
+                return To();
+            length = std::min(length, To::max_length());
+            chars &= string_n_helper::prefix_mask_<uint64_t>(length);
+        }
+        if constexpr (stores_length_<To>)
+            chars |= static_cast<uint64_t>(length) << string_n_helper::byte_shift_<uint64_t>(To::max_length());
+        if constexpr (std::endian::native == std::endian::big)
+            chars >>= 8 * (sizeof(uint64_t) - sizeof(uint));
+        return To::from_integer(static_cast<uint>(chars));
+    }
+};
+
+/**
+ * @brief Convert a string-N value to another string-N type with shifts and masks.
+ * @param str The value to convert.
+ * @param policy What to do if str is longer than To::max_length().
+ * @param truncated Set to true if str is longer than To::max_length(), false otherwise.
+ *
+ * strn::string32 tier2 = strn::string_n_cast<strn::string32>("AAPL"_s64);
+ */
+template <string_n To, string_n From>
+inline constexpr To string_n_cast(const From& str, truncation_policy policy, bool& truncated)
+{
+    return string_n_caster_::cast_<To>(str, policy, truncated);
+}
+
+/**
+ * @brief Convert a string-N value to another string-N type, keeping its first To::max_length() characters.
+ */
+template <string_n To, string_n From>
+inline constexpr To string_n_cast(const From& str)
+{
+    bool truncated = false;
+    return string_n_cast<To>(str, truncation_policy::truncate, truncated);
+}
+
+/**
+ * @brief Tell whether two string-N values of different types hold the same characters.
+ */
+template <string_n Lhs, string_n Rhs>
+    requires(!std::is_same_v<Lhs, Rhs>)
+inline constexpr bool operator==(const Lhs& lhs, const Rhs& rhs)
+{
+    return string_n_caster_::chars_(lhs) == string_n_caster_::chars_(rhs);
+}
+
+} // namespace strn
+} // namespace arba
@@ -0,0 +1,152 @@
+#pragma once
+
+#include "string_n_traits.hpp"
+
+#include <algorithm>
+#include <charconv>
+#include <format>
+#include <string_view>
+
+inline namespace arba
+{
+namespace strn
+{
+
+/**
+ * @brief Common implementation of the std::formatter specializations of string32, string56 and string64.
+ *
+ * Supported format specs:
+ * - {} : the characters, copied directly to the output (no padding or alignment machinery).
+ * - {:x} : the hexadecimal form of integer(), like std::format("{:x}", str.integer()).
+ * - {:q} : the characters between double quotes, with '"', '\\' and non-printable characters escaped.
+ * - {:U} / {:L} : the characters in upper / lower case (ASCII).
+ * - any other spec is the std::string_view one (e.g. {:>8}).
+ */
+template <class StringN, class CharT>
+struct string_n_formatter
+{
+private:
+    enum class format_mode_ : char
+    {
+        plain,
+        hex,
+        quoted,
+        upper,
+        lower,
+        string_view
+    };
+
+public:
+    constexpr auto parse(std::basic_format_parse_context<CharT>& ctx)
+    {
+        auto iter = ctx.begin();
+        if (iter == ctx.end() || *iter == '}')
+        {
+            mode_ = format_mode_::plain;
+            return iter;
+        }
+        if (auto next = iter + 1; next == ctx.end() || *next == '}')
+        {
+            switch (*iter)
+            {
+            case 'x':
+                mode_ = format_mode_::hex;
+                return next;
+            case 'q':
+                mode_ = format_mode_::quoted;
+                return next;
+            case 'U':
+                mode_ = format_mode_::upper;
+                return next;
+            case 'L':
+                mode_ = format_mode_::lower;
+                return next;
+            default:
+                break;
+            }
+        }
+        mode_ = format_mode_::string_view;
+        return string_view_formatter_.parse(ctx);
+    }
+
+    /**
+     * @brief Format str, which can be of any string-N type, so that a composite value (key_pair) formats all its
+     * parts with one parsed spec.
+     */
+    template <string_n Str, class FormatContext>
+    auto format(const Str& str, FormatContext& ctx) const
+    {
+        auto out = ctx.out();
+        switch (mode_)
+        {
+        case format_mode_::plain:
+            return std::copy(str.begin(), str.end(), out);
+        case format_mode_::hex:
+        {
+            char digits[2 * sizeof(typename Str::uint)];
+            const auto result = std::to_chars(std::begin(digits), std::end(digits), str.integer(), 16);
+            return std::copy(std::begin(digits), result.ptr, out);
+        }
+        case format_mode_::quoted:
+            return format_quoted_(str, out);
+        case format_mode_::upper:
+            return std::transform(str.begin(), str.end(), out,
+                                  [](char ch) { return (ch >= 'a' && ch <= 'z') ? static_cast<char>(ch - 32) : ch; });
+        case format_mode_::lower:
+            return std::transform(str.begin(), str.end(), out,
+                                  [](char ch) { return (ch >= 'A' && ch <= 'Z') ? static_cast<char>(ch + 32) : ch; });
+        default:
+            return string_view_formatter_.format(str.to_string_view(), ctx);
+        }
+    }
+
+private:
+    template <string_n Str, class OutputIt>
+    static OutputIt format_quoted_(const Str& str, OutputIt out)
+    {
+        constexpr std::string_view hex_digits = "0123456789abcdef";
+        *out++ = '"';
+        for (char ch : str)
+        {
+            switch (ch)
+            {
+            case '"':
+            case '\\':
+                *out++ = '\\';
+                *out++ = ch;
+                break;
+            case '\t':
+                *out++ = '\\';
+                *out++ = 't';
+                break;
+            case '\n':
+                *out++ = '\\';
+                *out++ = 'n';
+                break;
+            case '\r':
+                *out++ = '\\';
+                *out++ = 'r';
+                break;
+            default:
+                if (const auto byte = static_cast<unsigned char>(ch); byte < 0x20 || byte >= 0x7f)
+                {
+                    *out++ = '\\';
+                    *out++ = 'x';
+                    *out++ = hex_digits[byte >> 4];
+                    *out++ = hex_digits[byte & 0xf];
+                }
+                else
+                    *out++ = ch;
+            }
+        }
+        *out++ = '"';
+        return out;
+    }
+
+private:
+    std::formatter<std::basic_string_view<CharT>, CharT> string_view_formatter_;
+    format_mode_ mode_ = format_mode_::plain;
+};
+
+} // namespace strn
+} // namespace arba
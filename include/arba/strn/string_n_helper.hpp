@@ -2,64 +2,107 @@
 
 #include <bit>
 #include <cstdint>
+#include <limits>
 
 inline namespace arba
 {
 namespace strn
 {
 
+// Branchless operations on the integer representation of the characters of a string-N value: the character of index
+// i is the byte of index i in memory order. The positions are masked rather than tested, so that none of these
+// functions branches on the length of a string, and no shift reaches the width of the integer.
 class string_n_helper
 {
-    friend class string16;
     friend class string32;
+    friend class string56;
     friend class string64;
+    friend class string_n_caster_;
 
-    inline constexpr static std::size_t string16_length_(const uint16_t& bytes)
+    static_assert(std::endian::native == std::endian::little || std::endian::native == std::endian::big);
+
+    // The number of bytes before the last non-null byte, included.
+    template <class UInt>
+    inline constexpr static std::size_t length_(UInt bytes)
     {
-        static_assert(std::endian::native == std::endian::little || std::endian::native == std::endian::big);
-        static_assert(static_cast<std::size_t>(static_cast<bool>(true)) == std::size_t{ 1 });
+        constexpr int digits = std::numeric_limits<UInt>::digits;
+        if constexpr (std::endian::native == std::endian::little)
+            return static_cast<std::size_t>(digits - std::countl_zero(bytes) + 7) / 8;
+        else
+            return static_cast<std::size_t>(digits - std::countr_zero(bytes) + 7) / 8;
+    }
+
+    inline constexpr static std::size_t string32_length_(uint32_t bytes) { return length_(bytes); }
+    inline constexpr static std::size_t string64_length_(uint64_t bytes) { return length_(bytes); }
 
+    // The shift of the byte of index index, taken modulo sizeof(UInt).
+    template <class UInt>
+    inline constexpr static unsigned byte_shift_(std::size_t index)
+    {
+        index &= sizeof(UInt) - 1;
         if constexpr (std::endian::native == std::endian::little)
-        {
-            if ((bytes & 0xff00))
-                return 2;
-        }
+            return static_cast<unsigned>(8 * index);
         else
-        {
-            if ((bytes & 0x00ff))
-                return 2;
-        }
-        return static_cast<std::size_t>(static_cast<bool>(bytes));
+            return static_cast<unsigned>(8 * (sizeof(UInt) - 1 - index));
     }
 
-    inline constexpr static std::size_t string32_length_(const uint32_t& bytes)
+    // The mask of the bytes of index lower than count, for count in [0, sizeof(UInt)].
+    template <class UInt>
+    inline constexpr static UInt prefix_mask_(std::size_t count)
     {
+        // Two half shifts, so that count == sizeof(UInt) shifts all the bits out instead of being undefined.
+        const unsigned half_shift = static_cast<unsigned>(4 * count);
         if constexpr (std::endian::native == std::endian::little)
-        {
-            if ((bytes & 0xffff0000))
-                return 2 + string16_length_(bytes >> 16);
-        }
+            return static_cast<UInt>(((UInt(1) << half_shift) << half_shift) - 1);
         else
-        {
-            if ((bytes & 0x0000ffff))
-                return 2 + string16_length_(bytes << 16);
-        }
-        return string16_length_(bytes);
+            return static_cast<UInt>(~((UInt(~UInt(0)) >> half_shift) >> half_shift));
     }
 
-    inline constexpr static std::size_t string64_length_(const uint64_t& bytes)
+    // All ones if condition is true, zero otherwise.
+    template <class UInt>
+    inline constexpr static UInt condition_mask_(bool condition)
     {
+        return static_cast<UInt>(-static_cast<UInt>(condition));
+    }
+
+    template <class UInt>
+    inline constexpr static UInt broadcast_(char ch)
+    {
+        return static_cast<UInt>(static_cast<UInt>(static_cast<uint8_t>(ch)) * (UInt(~UInt(0)) / 0xff));
+    }
+
+    template <class UInt>
+    inline constexpr static UInt push_back_(UInt bytes, std::size_t length, std::size_t max_length, char ch)
+    {
+        const UInt byte = static_cast<UInt>(static_cast<UInt>(static_cast<uint8_t>(ch)) << byte_shift_<UInt>(length));
+        return bytes | (byte & condition_mask_<UInt>(length < max_length));
+    }
+
+    // An empty value has no byte to clear: clearing the byte of index -1 (modulo sizeof(UInt)) leaves it null.
+    template <class UInt>
+    inline constexpr static UInt pop_back_(UInt bytes, std::size_t length)
+    {
+        return bytes & static_cast<UInt>(~(UInt(0xff) << byte_shift_<UInt>(length - 1)));
+    }
+
+    // The characters chars moved after the first length characters, without those beyond max_length.
+    template <class UInt>
+    inline constexpr static UInt append_chars_(UInt chars, std::size_t length, std::size_t max_length)
+    {
+        // Two half shifts, so that a full value (length == sizeof(UInt)) shifts all the characters out.
+        const unsigned half_shift = static_cast<unsigned>(4 * length);
         if constexpr (std::endian::native == std::endian::little)
-        {
-            if ((bytes & 0xffffffff00000000))
-                return 4 + string32_length_(bytes >> 32);
-        }
+            return static_cast<UInt>(((chars << half_shift) << half_shift) & prefix_mask_<UInt>(max_length));
         else
-        {
-            if ((bytes & 0x00000000ffffffff))
-                return 4 + string32_length_(bytes << 32);
-        }
-        return string32_length_(bytes);
+            return static_cast<UInt>(((chars >> half_shift) >> half_shift) & prefix_mask_<UInt>(max_length));
+    }
+
+    template <class UInt>
+    inline constexpr static UInt resize_(UInt bytes, std::size_t length, std::size_t new_length, char ch)
+    {
+        const UInt kept = prefix_mask_<UInt>(new_length);
+        const UInt added = kept & static_cast<UInt>(~prefix_mask_<UInt>(length));
+        return (bytes & kept) | (broadcast_<UInt>(ch) & added);
     }
 };
 
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <concepts>
+#include <type_traits>
+
+inline namespace arba
+{
+namespace strn
+{
+
+class string32;
+class string56;
+class string64;
+
+template <typename T>
+struct is_string_n : public std::false_type
+{
+};
+
+template <>
+struct is_string_n<string32> : public std::true_type
+{
+};
+
+template <>
+struct is_string_n<string56> : public std::true_type
+{
+};
+
+template <>
+struct is_string_n<string64> : public std::true_type
+{
+};
+
+template <class T>
+inline constexpr bool is_string_n_v = is_string_n<std::remove_cv_t<T>>::value;
+
+/**
+ * @brief The string_n concept is satisfied by string32, string56 and string64.
+ */
+template <class T>
+concept string_n = is_string_n_v<T>;
+
+} // namespace strn
+} // namespace arba
@@ -0,0 +1,211 @@
+#pragma once
+
+#include "block_reader.hpp"
+#include "from_views.hpp"
+#include "string_n_traits.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstring>
+#include <filesystem>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <span>
+#include <string_view>
+
+inline namespace arba
+{
+namespace strn
+{
+
+/**
+ * @brief Options of a token_reader.
+ */
+struct token_reader_options : public block_reader_options
+{
+    /// The size of the reading buffer, rounded up to a multiple of block_reader::direct_io_alignment.
+    std::size_t block_size = std::size_t(1) << 20;
+};
+
+/**
+ * @brief The token_reader class streams the whitespace-separated tokens of a file as string-N values.
+ *
+ * The file is read in large blocks into a single buffer, reused for the whole file: memory is constant and no token
+ * is allocated. A token straddling two blocks is carried over. Like operator>>, overlong tokens are truncated to
+ * StringN::max_length() characters; truncated_count() tells how many were.
+ *
+ * strn::token_reader<strn::string64> reader("keys.txt");
+ * for (const strn::string64& key : reader) { ... }
+ */
+template <string_n StringN>
+class token_reader
+{
+private:
+    struct aligned_delete_
+    {
+        inline void operator()(std::byte* ptr) const
+        {
+            ::operator delete[](ptr, std::align_val_t(block_reader::direct_io_alignment));
+        }
+    };
+
+    // A carried token keeps one more character than max_length() to detect truncation.
+    inline constexpr static std::size_t carry_capacity_ = StringN::max_length() + 1;
+
+public:
+    class iterator
+    {
+    public:
+        using iterator_category = std::input_iterator_tag;
+        using value_type = StringN;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const StringN*;
+        using reference = const StringN&;
+
+        iterator() = default;
+        explicit iterator(token_reader& reader) : reader_(&reader) { ++*this; }
+
+        inline reference operator*() const { return token_; }
+        inline pointer operator->() const { return &token_; }
+
+        inline iterator& operator++()
+        {
+            if (!reader_->next(token_))
+                reader_ = nullptr;
+            return *this;
+        }
+
+        inline void operator++(int) { ++*this; }
+        inline bool operator==(const iterator& rhs) const { return reader_ == rhs.reader_; }
+
+    private:
+        token_reader* reader_ = nullptr;
+        StringN token_;
+    };
+
+    /**
+     * @brief token_reader
+     * @param fd An open file descriptor, read from its current position and not closed by the reader.
+     */
+    explicit token_reader(int fd, const token_reader_options& options = token_reader_options())
+        : reader_(fd, options), buffer_(allocate_(options.block_size)), block_size_(aligned_size_(options.block_size))
+    {
+    }
+
+    /**
+     * @brief token_reader
+     * @param path The file to read.
+     * @throw std::system_error If the file cannot be opened.
+     */
+    explicit token_reader(const std::filesystem::path& path,
+                          const token_reader_options& options = token_reader_options())
+        : reader_(path, options), buffer_(allocate_(options.block_size)), block_size_(aligned_size_(options.block_size))
+    {
+    }
+
+    /**
+     * @brief Read the next token.
+     * @param token Set to the next token, if any.
+     * @return false at the end of the file.
+     * @throw std::system_error If a read fails.
+     */
+    bool next(StringN& token)
+    {
+        for (;;)
+        {
+            if (pos_ == end_ && !refill_())
+            {
+                if (carry_size_ == 0)
+                    return false;
+                token = make_token_(std::string_view(carry_.data(), carry_size_));
+                carry_size_ = 0;
+                return true;
+            }
+            const char* data = reinterpret_cast<const char*>(buffer_.get());
+            if (carry_size_ == 0)
+            {
+                while (pos_ < end_ && is_space_(data[pos_]))
+                    ++pos_;
+                if (pos_ == end_)
+                    continue;
+            }
+            const std::size_t token_begin = pos_;
+            while (pos_ < end_ && !is_space_(data[pos_]))
+                ++pos_;
+            const std::string_view chunk(data + token_begin, pos_ - token_begin);
+            if (pos_ == end_)
+            {
+                // The token may go on in the next block.
+                const std::size_t count = std::min(chunk.length(), carry_capacity_ - carry_size_);
+                std::memcpy(carry_.data() + carry_size_, chunk.data(), count);
+                carry_size_ += count;
+                continue;
+            }
+            if (carry_size_ == 0)
+            {
+                token = make_token_(chunk);
+            }
+            else
+            {
+                const std::size_t count = std::min(chunk.length(), carry_capacity_ - carry_size_);
+                std::memcpy(carry_.data() + carry_size_, chunk.data(), count);
+                token = make_token_(std::string_view(carry_.data(), carry_size_ + count));
+                carry_size_ = 0;
+            }
+            return true;
+        }
+    }
+
+    inline iterator begin() { return iterator(*this); }
+    inline iterator end() { return iterator(); }
+
+    inline std::size_t truncated_count() const { return truncated_count_; }
+
+private:
+    inline static std::size_t aligned_size_(std::size_t size)
+    {
+        constexpr std::size_t alignment = block_reader::direct_io_alignment;
+        return std::max(alignment, (size + alignment - 1) / alignment * alignment);
+    }
+
+    inline static std::unique_ptr<std::byte[], aligned_delete_> allocate_(std::size_t size)
+    {
+        return std::unique_ptr<std::byte[], aligned_delete_>(static_cast<std::byte*>(
+            ::operator new[](aligned_size_(size), std::align_val_t(block_reader::direct_io_alignment))));
+    }
+
+    inline constexpr static bool is_space_(char ch)
+    {
+        return ch == ' ' || (ch >= '\t' && ch <= '\r');
+    }
+
+    inline StringN make_token_(std::string_view chars)
+    {
+        bool truncated = false;
+        const StringN token = from_view<StringN>(chars, truncation_policy::truncate, truncated);
+        truncated_count_ += truncated;
+        return token;
+    }
+
+    inline bool refill_()
+    {
+        pos_ = 0;
+        end_ = reader_.read(std::span<std::byte>(buffer_.get(), block_size_));
+        return end_ != 0;
+    }
+
+private:
+    block_reader reader_;
+    std::unique_ptr<std::byte[], aligned_delete_> buffer_;
+    std::size_t block_size_;
+    std::size_t pos_ = 0;
+    std::size_t end_ = 0;
+    std::array<char, carry_capacity_> carry_{};
+    std::size_t carry_size_ = 0;
+    std::size_t truncated_count_ = 0;
+};
+
+} // namespace strn
+} // namespace arba
@@ -0,0 +1,220 @@
+#pragma once
+
+#include "flat_hash_map.hpp"
+#include "string_n_traits.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+inline namespace arba
+{
+namespace strn
+{
+
+/**
+ * @brief The top_k class finds the most frequent string-N keys of a stream with capacity() counters (Space-Saving
+ * algorithm).
+ *
+ * A key not monitored takes the counter of the least frequent monitored key, so that each count overestimates the
+ * true count by at most its error, and every key occurring more than N / capacity() times (N being the total count
+ * added) is monitored. The counters are kept in a min-heap and found with a flat_hash_map: an update costs one hash
+ * lookup and a sift of the heap. Two summaries merge into a summary of both streams.
+ *
+ * strn::top_k<strn::string64> heavy_hitters(100);
+ * heavy_hitters.add(symbols);
+ * for (const auto& [symbol, count, error] : heavy_hitters.entries()) ...
+ */
+template <string_n StringN>
+class top_k
+{
+public:
+    using key_type = StringN;
+
+    struct entry
+    {
+        key_type key;
+        uint64_t count = 0; ///< The estimated count, never below the true count.
+        uint64_t error = 0; ///< The maximal overestimation: the true count is at least count - error.
+    };
+
+    /**
+     * @brief top_k
+     * @param capacity The number of monitored keys.
+     * @throw std::invalid_argument If capacity is 0.
+     */
+    explicit top_k(std::size_t capacity) : capacity_(capacity), slots_(capacity)
+    {
+        if (capacity == 0)
+            throw std::invalid_argument("strn::top_k: capacity must not be 0.");
+        entries_.reserve(capacity);
+        heap_.reserve(capacity);
+        heap_positions_.reserve(capacity);
+    }
+
+    inline std::size_t capacity() const { return capacity_; }
+    inline std::size_t size() const { return entries_.size(); }
+    inline bool empty() const { return entries_.empty(); }
+
+    void add(const key_type& key, uint64_t count = 1)
+    {
+        if (const uint32_t* slot = slots_.find(key))
+        {
+            entries_[*slot].count += count;
+            sift_down_(heap_positions_[*slot]);
+        }
+        else if (entries_.size() < capacity_)
+        {
+            const uint32_t new_slot = static_cast<uint32_t>(entries_.size());
+            entries_.push_back(entry{ key, count, 0 });
+            slots_.insert(key, new_slot);
+            heap_.push_back(new_slot);
+            heap_positions_.push_back(new_slot);
+            sift_up_(new_slot);
+        }
+        else
+        {
+            // Replace the least frequent key, whose count bounds the count the new key may have had.
+            const uint32_t least_slot = heap_.front();
+            entry& least = entries_[least_slot];
+            slots_.erase(least.key);
+            least = entry{ key, least.count + count, least.count };
+            slots_.insert(key, least_slot);
+            sift_down_(0);
+        }
+    }
+
+    inline void add(std::span<const key_type> keys)
+    {
+        for (const key_type& key : keys)
+            add(key);
+    }
+
+    /**
+     * @brief Add the counts of another summary: this summary becomes a summary of both streams.
+     *
+     * A key monitored by only one summary is given the least count of the other one (if it is full) as count and
+     * error, then only the capacity() keys with the greatest counts are kept.
+     */
+    void merge(const top_k& other)
+    {
+        const uint64_t this_floor = floor_(), other_floor = other.floor_();
+        std::vector<entry> merged;
+        merged.reserve(entries_.size() + other.entries_.size());
+        for (const entry& item : entries_)
+        {
+            if (const uint32_t* slot = other.slots_.find(item.key))
+            {
+                const entry& other_item = other.entries_[*slot];
+                merged.push_back(entry{ item.key, item.count + other_item.count, item.error + other_item.error });
+            }
+            else
+                merged.push_back(entry{ item.key, item.count + other_floor, item.error + other_floor });
+        }
+        for (const entry& other_item : other.entries_)
+            if (!slots_.contains(other_item.key))
+                merged.push_back(
+                    entry{ other_item.key, other_item.count + this_floor, other_item.error + this_floor });
+
+        if (merged.size() > capacity_)
+        {
+            std::nth_element(merged.begin(), merged.begin() + capacity_, merged.end(), greater_count_);
+            merged.resize(capacity_);
+        }
+        // Sorted by increasing count, the entries are a heap in which the slot of each entry is its position.
+        std::sort(merged.begin(), merged.end(),
+                  [](const entry& lhs, const entry& rhs) { return lhs.count < rhs.count; });
+        entries_ = std::move(merged);
+        slots_.clear();
+        heap_.resize(entries_.size());
+        heap_positions_.resize(entries_.size());
+        for (std::size_t i = 0; i < entries_.size(); ++i)
+        {
+            slots_.insert(entries_[i].key, static_cast<uint32_t>(i));
+            heap_[i] = heap_positions_[i] = static_cast<uint32_t>(i);
+        }
+    }
+
+    /**
+     * @brief The monitored keys, by decreasing count.
+     */
+    std::vector<entry> entries() const
+    {
+        std::vector<entry> result = entries_;
+        std::sort(result.begin(), result.end(), greater_count_);
+        return result;
+    }
+
+    inline void clear()
+    {
+        entries_.clear();
+        heap_.clear();
+        heap_positions_.clear();
+        slots_.clear();
+    }
+
+private:
+    inline constexpr static auto greater_count_ = [](const entry& lhs, const entry& rhs) {
+        return lhs.count > rhs.count;
+    };
+
+    // The count a key not monitored may have had.
+    inline uint64_t floor_() const { return entries_.size() == capacity_ ? entries_[heap_.front()].count : 0; }
+
+    inline uint64_t heap_count_(std::size_t index) const { return entries_[heap_[index]].count; }
+
+    inline void place_(std::size_t index, uint32_t slot)
+    {
+        heap_[index] = slot;
+        heap_positions_[slot] = static_cast<uint32_t>(index);
+    }
+
+    void sift_up_(std::size_t index)
+    {
+        const uint32_t slot = heap_[index];
+        const uint64_t count = entries_[slot].count;
+        while (index > 0)
+        {
+            const std::size_t parent = (index - 1) / 2;
+            if (heap_count_(parent) <= count)
+                break;
+            place_(index, heap_[parent]);
+            index = parent;
+        }
+        place_(index, slot);
+    }
+
+    void sift_down_(std::size_t index)
+    {
+        const uint32_t slot = heap_[index];
+        const uint64_t count = entries_[slot].count;
+        for (;;)
+        {
+            std::size_t child = 2 * index + 1;
+            if (child >= heap_.size())
+                break;
+            // Branchless: the sibling comparison is unpredictable once many counts are equal.
+            const std::size_t sibling = std::min(child + 1, heap_.size() - 1);
+            child += heap_count_(sibling) < heap_count_(child);
+            if (count <= heap_count_(child))
+                break;
+            place_(index, heap_[child]);
+            index = child;
+        }
+        place_(index, slot);
+    }
+
+private:
+    std::size_t capacity_;
+    // The entries never move: the heap holds their slots, and the hash table maps each key to its slot, so that
+    // sifting the heap never updates the hash table.
+    std::vector<entry> entries_;
+    std::vector<uint32_t> heap_;
+    std::vector<uint32_t> heap_positions_;
+    flat_hash_map<key_type, uint32_t> slots_;
+};
+
+} // namespace strn
+} // namespace arba
@@ -0,0 +1,2 @@
+#include <arba/strn/binary_io.hpp>
+#include <arba/strn/impl/binary_io.hpp>
@@ -0,0 +1,2 @@
+#include <arba/strn/block_reader.hpp>
+#include <arba/strn/impl/block_reader.hpp>
@@ -0,0 +1,2 @@
+#include <arba/strn/mapped_file.hpp>
+#include <arba/strn/impl/mapped_file.hpp>
@@ -0,0 +1,2 @@
+#include <arba/strn/stats.hpp>
+#include <arba/strn/impl/stats.hpp>
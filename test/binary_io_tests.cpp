@@ -0,0 +1,84 @@
+#include <arba/strn/binary_io.hpp>
+#include <arba/strn/string32.hpp>
+#include <arba/strn/string56.hpp>
+#include <arba/strn/string64.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <sstream>
+#include <vector>
+
+using namespace strn::literals;
+
+TEST(binary_io_tests, test_to_le_bytes)
+{
+    constexpr auto bytes = strn::to_le_bytes("abc"_s64);
+    static_assert(bytes[0] == std::byte('a') && bytes[1] == std::byte('b') && bytes[2] == std::byte('c'));
+    static_assert(bytes[3] == std::byte(0) && bytes[7] == std::byte(0));
+    constexpr auto bytes56 = strn::to_le_bytes("abc"_s56);
+    static_assert(bytes56[0] == std::byte('a') && bytes56[6] == std::byte(0) && bytes56[7] == std::byte(3));
+    constexpr auto bytes32 = strn::to_le_bytes("EUR"_s32);
+    static_assert(bytes32.size() == 4 && bytes32[2] == std::byte('R'));
+}
+
+TEST(binary_io_tests, test_from_le_bytes)
+{
+    static_assert(strn::from_le_bytes<strn::string64>(strn::to_le_bytes("abcdefgh"_s64)) == "abcdefgh"_s64);
+    static_assert(strn::from_le_bytes<strn::string56>(strn::to_le_bytes("abc"_s56)) == "abc"_s56);
+    static_assert(strn::from_le_bytes<strn::string32>(strn::to_le_bytes("EUR"_s32)) == "EUR"_s32);
+}
+
+TEST(binary_io_tests, test_le_bytes_memcmp_order)
+{
+    std::vector<strn::string64> strs{ "bb"_s64, "aaa"_s64, "b"_s64, "a"_s64, "ab"_s64 };
+    std::ranges::sort(strs, [](const strn::string64& lhs, const strn::string64& rhs) {
+        return std::memcmp(strn::to_le_bytes(lhs).data(), strn::to_le_bytes(rhs).data(), 8) < 0;
+    });
+    ASSERT_EQ(strs, (std::vector<strn::string64>{ "a"_s64, "aaa"_s64, "ab"_s64, "b"_s64, "bb"_s64 }));
+}
+
+TEST(binary_io_tests, test_be_integer)
+{
+    static_assert(strn::to_be_integer("ab"_s64) == 0x6162000000000000ull);
+    static_assert(strn::to_be_integer("EUR"_s32) == 0x45555200u);
+    static_assert(strn::to_be_integer("b"_s64) > strn::to_be_integer("aaa"_s64));
+    static_assert(strn::from_be_integer<strn::string64>(strn::to_be_integer("abcdefgh"_s64)) == "abcdefgh"_s64);
+}
+
+TEST(binary_io_tests, test_stream_write_read_into)
+{
+    const std::vector<strn::string64> strs{ "a"_s64, "abcdefgh"_s64, ""_s64, "xyz"_s64 };
+    std::stringstream stream;
+    ASSERT_TRUE(strn::write<strn::string64>(stream, strs));
+    ASSERT_EQ(stream.str().size(), strs.size() * 8);
+    ASSERT_EQ(stream.str().substr(8, 8), "abcdefgh");
+
+    std::vector<strn::string64> read_strs(strs.size());
+    ASSERT_TRUE(strn::read_into<strn::string64>(stream, read_strs));
+    ASSERT_EQ(read_strs, strs);
+
+    std::vector<strn::string64> more_strs(1);
+    ASSERT_FALSE(strn::read_into<strn::string64>(stream, more_strs));
+    ASSERT_EQ(stream.gcount(), 0);
+}
+
+TEST(binary_io_tests, test_fd_write_read_into)
+{
+    std::FILE* file = std::tmpfile();
+    ASSERT_NE(file, nullptr);
+    const int fd = fileno(file);
+    std::vector<strn::string56> strs;
+    for (int i = 0; i < 2'000; ++i)
+        strs.emplace_back(std::to_string(i));
+    ASSERT_TRUE(strn::write<strn::string56>(fd, strs));
+    std::rewind(file);
+
+    std::vector<strn::string56> read_strs(strs.size() + 10);
+    ASSERT_EQ(strn::read_into<strn::string56>(fd, read_strs), strs.size());
+    read_strs.resize(strs.size());
+    ASSERT_EQ(read_strs, strs);
+    std::fclose(file);
+}
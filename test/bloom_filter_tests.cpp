@@ -0,0 +1,119 @@
+#include <arba/strn/bloom_filter.hpp>
+#include <arba/strn/string32.hpp>
+#include <arba/strn/string64.hpp>
+
+#include <gtest/gtest.h>
+
+#include "test_keys.hpp"
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace strn::literals;
+using test_keys::make_keys;
+
+TEST(bloom_filter_tests, test_empty)
+{
+    strn::bloom_filter<strn::string64> filter(100);
+    ASSERT_FALSE(filter.may_contain("AAPL"_s64));
+    ASSERT_FALSE(filter.may_contain(""_s64));
+}
+
+TEST(bloom_filter_tests, test_insert_may_contain)
+{
+    strn::bloom_filter<strn::string64> filter(100);
+    filter.insert("AAPL"_s64);
+    filter.insert("MSFT"_s64);
+    ASSERT_TRUE(filter.may_contain("AAPL"_s64));
+    ASSERT_TRUE(filter.may_contain("MSFT"_s64));
+    filter.clear();
+    ASSERT_FALSE(filter.may_contain("AAPL"_s64));
+}
+
+TEST(bloom_filter_tests, test_no_false_negative_and_low_false_positive_rate)
+{
+    const std::vector<strn::string64> keys = make_keys(10'000, "K");
+    const std::vector<strn::string64> others = make_keys(10'000, "X");
+    strn::bloom_filter<strn::string64> filter(keys.size());
+    filter.insert(keys);
+    for (const strn::string64& key : keys)
+        ASSERT_TRUE(filter.may_contain(key));
+    std::size_t false_positives = 0;
+    for (const strn::string64& key : others)
+        false_positives += filter.may_contain(key);
+    ASSERT_LT(false_positives, others.size() / 20);
+}
+
+TEST(bloom_filter_tests, test_batch_may_contain)
+{
+    const std::vector<strn::string64> keys = make_keys(1'000, "K");
+    strn::bloom_filter<strn::string64> filter(keys.size() / 2);
+    filter.insert(std::span(keys).first(keys.size() / 2));
+    const std::vector<strn::string64> queries = make_keys(1'500, "K");
+    strn::bitmask result;
+    filter.may_contain(queries, result);
+    ASSERT_EQ(result.size(), queries.size());
+    for (std::size_t i = 0; i < queries.size(); ++i)
+        ASSERT_EQ(result[i], filter.may_contain(queries[i]));
+}
+
+TEST(bloom_filter_tests, test_string32)
+{
+    strn::bloom_filter<strn::string32> filter(10);
+    filter.insert("EUR"_s32);
+    ASSERT_TRUE(filter.may_contain("EUR"_s32));
+}
+
+TEST(bloom_filter_tests, test_serialize_deserialize)
+{
+    const std::vector<strn::string64> keys = make_keys(1'000, "K");
+    strn::bloom_filter<strn::string64> filter(keys.size());
+    filter.insert(keys);
+    std::stringstream stream;
+    ASSERT_TRUE(filter.serialize(stream));
+
+    strn::bloom_filter<strn::string64> read_filter;
+    ASSERT_TRUE(read_filter.deserialize(stream));
+    ASSERT_EQ(read_filter.block_count(), filter.block_count());
+    for (const strn::string64& key : keys)
+        ASSERT_TRUE(read_filter.may_contain(key));
+}
+
+TEST(bloom_filter_tests, test_deserialize_bad_input)
+{
+    strn::bloom_filter<strn::string64> filter(10);
+    filter.insert("AAPL"_s64);
+    std::stringstream stream("not a filter");
+    ASSERT_FALSE(filter.deserialize(stream));
+    ASSERT_TRUE(filter.may_contain("AAPL"_s64));
+
+    std::stringstream s32_stream;
+    strn::bloom_filter<strn::string32>(10).serialize(s32_stream);
+    std::stringstream s64_stream(s32_stream.str());
+    ASSERT_FALSE(filter.deserialize(s64_stream));
+}
+
+TEST(bloom_filter_tests, test_deserialize_huge_block_count)
+{
+    std::stringstream valid_stream;
+    strn::bloom_filter<strn::string64>(100).serialize(valid_stream);
+    const std::string valid = valid_stream.str();
+    strn::bloom_filter<strn::string64> filter(10);
+    filter.insert("AAPL"_s64);
+    for (uint64_t block_count : { uint64_t(1) << 40, ~uint64_t(0) })
+    {
+        // The block count follows the magic and the key length.
+        std::string bytes = valid;
+        for (std::size_t i = 0; i < sizeof(block_count); ++i)
+            bytes[16 + i] = static_cast<char>(block_count >> (8 * i));
+        std::stringstream stream(bytes);
+        ASSERT_FALSE(filter.deserialize(stream));
+        ASSERT_TRUE(filter.may_contain("AAPL"_s64));
+        ASSERT_EQ(filter.block_count(), strn::bloom_filter<strn::string64>(10).block_count());
+    }
+
+    std::stringstream truncated(valid.substr(0, valid.size() - 1));
+    ASSERT_FALSE(filter.deserialize(truncated));
+    ASSERT_TRUE(filter.may_contain("AAPL"_s64));
+}
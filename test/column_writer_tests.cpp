@@ -0,0 +1,75 @@
+#include <arba/strn/column_writer.hpp>
+#include <arba/strn/string32.hpp>
+#include <arba/strn/string56.hpp>
+#include <arba/strn/string64.hpp>
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace strn::literals;
+
+TEST(column_writer_tests, test_csv_clean)
+{
+    const std::vector<strn::string64> strs{ "AAPL"_s64, ""_s64, "12345678"_s64, "a b"_s64 };
+    std::string output;
+    strn::write_csv_column<strn::string64>(strs, output);
+    ASSERT_EQ(output, "AAPL\n\n12345678\na b\n");
+}
+
+TEST(column_writer_tests, test_csv_quoted)
+{
+    const std::vector<strn::string64> strs{ "a,b"_s64, "a\"b"_s64, "a\nb"_s64, "a\\b"_s64, "\x1f"_s64 };
+    std::string output;
+    strn::write_csv_column<strn::string64>(strs, output);
+    ASSERT_EQ(output, "\"a,b\"\n\"a\"\"b\"\n\"a\nb\"\na\\b\n\"\x1f\"\n");
+}
+
+TEST(column_writer_tests, test_csv_string56)
+{
+    // The length byte of string56 must not be taken for a control character.
+    const std::vector<strn::string56> strs{ "ab"_s56, "a,"_s56 };
+    std::ostringstream stream;
+    strn::write_csv_column<strn::string56>(strs, stream);
+    ASSERT_EQ(stream.str(), "ab\n\"a,\"\n");
+}
+
+TEST(column_writer_tests, test_json_clean)
+{
+    const std::vector<strn::string32> strs{ "EUR"_s32, ""_s32, "a,b"_s32 };
+    std::string output;
+    strn::write_json_array<strn::string32>(strs, output);
+    ASSERT_EQ(output, "[\"EUR\",\"\",\"a,b\"]");
+    output.clear();
+    strn::write_json_array<strn::string32>({}, output);
+    ASSERT_EQ(output, "[]");
+}
+
+TEST(column_writer_tests, test_json_escaped)
+{
+    const std::vector<strn::string64> strs{ "a\"b"_s64, "a\\b"_s64, "a\tb\n"_s64,
+                                          strn::string64(std::string_view("\x01\x7f\xe9")) };
+    std::ostringstream stream;
+    strn::write_json_array<strn::string64>(strs, stream);
+    ASSERT_EQ(stream.str(), "[\"a\\\"b\",\"a\\\\b\",\"a\\tb\\n\",\"\\u0001\x7f\xe9\"]");
+}
+
+TEST(column_writer_tests, test_all_single_bytes)
+{
+    // Every single character is escaped in JSON if and only if it is a quote, a backslash or a control character.
+    for (int byte = 1; byte < 256; ++byte)
+    {
+        const char ch = static_cast<char>(byte);
+        const strn::string64 str(std::string_view(&ch, 1));
+        std::string output;
+        strn::write_json_array<strn::string64>(std::span(&str, 1), output);
+        const bool escaped = ch == '"' || ch == '\\' || byte < 0x20;
+        ASSERT_EQ(output.size() != 5, escaped) << byte;
+        output.clear();
+        strn::write_csv_column<strn::string64>(std::span(&str, 1), output);
+        const bool quoted = ch == '"' || ch == ',' || byte < 0x20;
+        ASSERT_EQ(output.size() != 2, quoted) << byte;
+    }
+}
@@ -0,0 +1,52 @@
+#include <arba/strn/concat.hpp>
+#include <arba/strn/string32.hpp>
+#include <arba/strn/string56.hpp>
+#include <arba/strn/string64.hpp>
+
+#include <gtest/gtest.h>
+
+#include <optional>
+
+using namespace strn::literals;
+
+static_assert("XN"_s64 + "AS"_s64 == "XNAS"_s64);
+static_assert(strn::concat<strn::string64>("XN"_s32, "AS"_s56, "-1"_s64) == "XNAS-1"_s64);
+static_assert(!strn::concat<strn::string32, strn::overflow_policy::optional>("ABC"_s32, "DE"_s32));
+
+TEST(concat_tests, test_concat)
+{
+    ASSERT_EQ(strn::concat<strn::string64>(), ""_s64);
+    ASSERT_EQ(strn::concat<strn::string64>("ABC"_s64), "ABC"_s64);
+    ASSERT_EQ(strn::concat<strn::string64>("AB"_s64, ""_s64, "CD"_s64, "E"_s64), "ABCDE"_s64);
+    ASSERT_EQ(strn::concat<strn::string56>("AB"_s32, "CDE"_s64, "FG"_s56), "ABCDEFG"_s56);
+    ASSERT_EQ(strn::concat<strn::string56>("AB"_s32, "CDE"_s64, "FG"_s56).length(), 7);
+}
+
+TEST(concat_tests, test_concat_truncate)
+{
+    ASSERT_EQ(strn::concat<strn::string32>("ABC"_s32, "DEF"_s32), "ABCD"_s32);
+    ASSERT_EQ(strn::concat<strn::string32>("ABC"_s32, "DEF"_s32, "G"_s32), "ABCD"_s32);
+    ASSERT_EQ(strn::concat<strn::string32>("ABCDEFGH"_s64, "I"_s32), "ABCD"_s32);
+    ASSERT_EQ(strn::concat<strn::string56>("ABCDE"_s56, "FGHIJ"_s64), "ABCDEFG"_s56);
+    ASSERT_EQ(strn::concat<strn::string56>("ABCDE"_s56, "FGHIJ"_s64).length(), 7);
+}
+
+TEST(concat_tests, test_concat_saturate)
+{
+    constexpr strn::overflow_policy saturate = strn::overflow_policy::saturate;
+    ASSERT_EQ((strn::concat<strn::string32, saturate>("AB"_s32, "CD"_s32)), "ABCD"_s32);
+    ASSERT_EQ((strn::concat<strn::string32, saturate>("ABC"_s32, "DE"_s32)), "ABC"_s32);
+    ASSERT_EQ((strn::concat<strn::string32, saturate>("ABC"_s32, "DE"_s32, "F"_s32)), "ABC"_s32);
+    ASSERT_EQ((strn::concat<strn::string32, saturate>("ABCDE"_s64)), ""_s32);
+    ASSERT_EQ((strn::concat<strn::string56, saturate>("ABCD"_s56, "EFGH"_s64)).length(), 4);
+}
+
+TEST(concat_tests, test_concat_optional)
+{
+    constexpr strn::overflow_policy optional = strn::overflow_policy::optional;
+    const std::optional<strn::string64> key = strn::concat<strn::string64, optional>("XNAS"_s64, "."_s32, "AB"_s56);
+    ASSERT_TRUE(key.has_value());
+    ASSERT_EQ(*key, "XNAS.AB"_s64);
+    ASSERT_FALSE((strn::concat<strn::string64, optional>("XNAS"_s64, "."_s32, "ABCD"_s56)));
+    ASSERT_FALSE((strn::concat<strn::string32, optional>("ABCDE"_s64)));
+}
@@ -0,0 +1,75 @@
+#include <arba/strn/count_min_sketch.hpp>
+#include <arba/strn/string64.hpp>
+
+#include <gtest/gtest.h>
+
+#include "test_keys.hpp"
+
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace strn::literals;
+using test_keys::zipf_keys;
+
+TEST(count_min_sketch_tests, test_empty)
+{
+    strn::count_min_sketch<strn::string64> sketch(1024, 4);
+    ASSERT_EQ(sketch.width(), 1024);
+    ASSERT_EQ(sketch.depth(), 4);
+    ASSERT_EQ(sketch.estimate("AAPL"_s64), 0);
+    ASSERT_EQ(sketch.size_in_bytes(), 1024 * 4 * sizeof(uint64_t));
+}
+
+TEST(count_min_sketch_tests, test_add_estimate)
+{
+    strn::count_min_sketch<strn::string64> sketch(1024, 4);
+    sketch.add("AAPL"_s64);
+    sketch.add("AAPL"_s64, 9);
+    sketch.add(""_s64, 2);
+    ASSERT_EQ(sketch.estimate("AAPL"_s64), 10);
+    ASSERT_EQ(sketch.estimate(""_s64), 2);
+    ASSERT_EQ(sketch.total_count(), 12);
+    sketch.clear();
+    ASSERT_EQ(sketch.estimate("AAPL"_s64), 0);
+    ASSERT_EQ(sketch.total_count(), 0);
+}
+
+TEST(count_min_sketch_tests, test_error_bound)
+{
+    const std::vector<strn::string64> keys = zipf_keys(500'000, 20'000, 5);
+    std::map<strn::string64, uint64_t> expected;
+    for (const strn::string64& key : keys)
+        ++expected[key];
+    strn::count_min_sketch<strn::string64> sketch(1 << 14, 4);
+    sketch.add(keys);
+    const uint64_t bound = 3 * keys.size() / sketch.width();
+    std::size_t above_bound = 0;
+    for (const auto& [key, count] : expected)
+    {
+        const uint64_t estimate = sketch.estimate(key);
+        ASSERT_GE(estimate, count);
+        above_bound += estimate - count > bound;
+    }
+    ASSERT_LT(above_bound, expected.size() / 20);
+}
+
+TEST(count_min_sketch_tests, test_merge)
+{
+    const std::vector<strn::string64> keys = zipf_keys(100'000, 1'000, 5);
+    const std::span<const strn::string64> all(keys);
+    strn::count_min_sketch<strn::string64> whole(4096), first_half(4096), second_half(4096);
+    whole.add(all);
+    first_half.add(all.first(keys.size() / 2));
+    second_half.add(all.subspan(keys.size() / 2));
+    first_half.merge(second_half);
+    ASSERT_EQ(first_half.total_count(), whole.total_count());
+    for (std::size_t i = 0; i < 1'000; ++i)
+    {
+        const strn::string64 key("S" + std::to_string(i));
+        ASSERT_EQ(first_half.estimate(key), whole.estimate(key));
+    }
+    strn::count_min_sketch<strn::string64> narrow(1024);
+    ASSERT_THROW(whole.merge(narrow), std::invalid_argument);
+}
@@ -0,0 +1,107 @@
+#include <arba/strn/enum_traits.hpp>
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+
+using namespace strn::literals;
+
+enum class side : uint64_t
+{
+    buy = "BUY"_e64,
+    sell = "SELL"_e64,
+    short_sell = "SHORT"_e64,
+};
+
+template <>
+struct strn::enum_registry<side>
+{
+    inline constexpr static std::array values{ side::buy, side::sell, side::short_sell };
+};
+
+enum class currency : uint32_t
+{
+    eur = "EUR"_e32,
+    usd = "USD"_e32,
+};
+
+template <>
+struct strn::enum_registry<currency>
+{
+    inline constexpr static std::array values{ currency::eur, currency::usd };
+};
+
+enum class venue : uint64_t
+{
+    xpar = "XPAR"_e56,
+    xnys = "XNYS"_e56,
+};
+
+template <>
+struct strn::enum_registry<venue>
+{
+    using string_type = strn::string56;
+    inline constexpr static std::array values{ venue::xpar, venue::xnys };
+};
+
+using side_traits = strn::enum_traits<side>;
+static_assert(std::is_same_v<side_traits::string_type, strn::string64>);
+static_assert(std::is_same_v<strn::enum_traits<currency>::string_type, strn::string32>);
+static_assert(std::is_same_v<strn::enum_traits<venue>::string_type, strn::string56>);
+static_assert(side_traits::size() == 3);
+static_assert(side_traits::is_valid(side::sell));
+static_assert(!side_traits::is_valid(static_cast<side>("BUYS"_e64)));
+static_assert(side_traits::index_of(side::short_sell) == 2);
+
+constexpr int valid_count()
+{
+    int count = 0;
+    for (side value : side_traits::values())
+        count += side_traits::is_valid(value);
+    return count;
+}
+static_assert(valid_count() == 3);
+
+TEST(enum_traits_tests, test_is_valid)
+{
+    ASSERT_TRUE(side_traits::is_valid(side::buy));
+    ASSERT_FALSE(side_traits::is_valid(static_cast<side>(0)));
+    ASSERT_FALSE(side_traits::is_valid(static_cast<side>("buy"_e64)));
+    ASSERT_TRUE(strn::enum_traits<currency>::is_valid(currency::usd));
+    ASSERT_FALSE(strn::enum_traits<currency>::is_valid(static_cast<currency>("JPY"_e32)));
+    ASSERT_TRUE(strn::enum_traits<venue>::is_valid(venue::xnys));
+    ASSERT_FALSE(strn::enum_traits<venue>::is_valid(static_cast<venue>("XNY"_e56)));
+}
+
+TEST(enum_traits_tests, test_parse)
+{
+    ASSERT_EQ(side_traits::parse("SELL"), side::sell);
+    ASSERT_EQ(side_traits::parse("SHORT"), side::short_sell);
+    ASSERT_EQ(side_traits::parse("SHORTS"), std::nullopt);
+    ASSERT_EQ(side_traits::parse(""), std::nullopt);
+    ASSERT_EQ(side_traits::parse("BUY_____"), std::nullopt);
+    ASSERT_EQ(side_traits::parse("BUY______"), std::nullopt);
+    ASSERT_EQ(strn::enum_traits<currency>::parse("EUR"), currency::eur);
+    ASSERT_EQ(strn::enum_traits<currency>::parse("EURO"), std::nullopt);
+    ASSERT_EQ(strn::enum_traits<currency>::parse("EUR01"), std::nullopt);
+    ASSERT_EQ(strn::enum_traits<venue>::parse("XPAR"), venue::xpar);
+    ASSERT_EQ(strn::enum_traits<venue>::parse("XPA"), std::nullopt);
+}
+
+TEST(enum_traits_tests, test_index_of)
+{
+    std::array<int, side_traits::size()> counts{};
+    for (side value : { side::buy, side::sell, side::buy })
+        ++counts[side_traits::index_of(value)];
+    ASSERT_EQ(counts[0], 2);
+    ASSERT_EQ(counts[1], 1);
+    ASSERT_EQ(counts[2], 0);
+    ASSERT_EQ(side_traits::index_of(static_cast<side>("SELLS"_e64)), side_traits::size());
+}
+
+TEST(enum_traits_tests, test_to_string_n)
+{
+    ASSERT_EQ(side_traits::to_string_n(side::short_sell), "SHORT"_s64);
+    ASSERT_EQ(strn::enum_traits<venue>::to_string_n(venue::xpar).to_string_view(), "XPAR");
+}
@@ -0,0 +1,164 @@
+#include <arba/strn/flat_hash_map.hpp>
+#include <arba/strn/string32.hpp>
+#include <arba/strn/string64.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+using namespace strn::literals;
+
+TEST(flat_hash_map_tests, test_empty)
+{
+    strn::flat_hash_map<strn::string64, int> map;
+    ASSERT_TRUE(map.empty());
+    ASSERT_EQ(map.size(), 0);
+    ASSERT_EQ(map.find("AAPL"_s64), nullptr);
+    ASSERT_EQ(map.find(""_s64), nullptr);
+}
+
+TEST(flat_hash_map_tests, test_insert_find)
+{
+    strn::flat_hash_map<strn::string64, int> map;
+    ASSERT_TRUE(map.insert("AAPL"_s64, 1).second);
+    ASSERT_TRUE(map.insert(""_s64, 2).second);
+    auto [value, inserted] = map.insert("AAPL"_s64, 3);
+    ASSERT_FALSE(inserted);
+    ASSERT_EQ(*value, 1);
+    ASSERT_EQ(map.size(), 2);
+    ASSERT_EQ(*map.find("AAPL"_s64), 1);
+    ASSERT_EQ(*map.find(""_s64), 2);
+    ASSERT_FALSE(map.insert_or_assign("AAPL"_s64, 4));
+    ASSERT_EQ(*map.find("AAPL"_s64), 4);
+    map["MSFT"_s64] += 5;
+    ASSERT_EQ(*map.find("MSFT"_s64), 5);
+    map.clear();
+    ASSERT_TRUE(map.empty());
+    ASSERT_FALSE(map.contains("AAPL"_s64));
+}
+
+TEST(flat_hash_map_tests, test_against_unordered_map)
+{
+    std::mt19937_64 engine(7);
+    std::uniform_int_distribution<int> key_dist(0, 3'000), op_dist(0, 2);
+    strn::flat_hash_map<strn::string64, int> map;
+    std::unordered_map<strn::string64, int> reference;
+    for (int i = 0; i < 50'000; ++i)
+    {
+        const strn::string64 key(std::to_string(key_dist(engine)));
+        switch (op_dist(engine))
+        {
+        case 0:
+            ASSERT_EQ(map.insert(key, i).second, reference.emplace(key, i).second);
+            break;
+        case 1:
+            ASSERT_EQ(map.erase(key), reference.erase(key) == 1);
+            break;
+        default:
+        {
+            const auto iter = reference.find(key);
+            const int* value = map.find(key);
+            ASSERT_EQ(value != nullptr, iter != reference.end());
+            if (value)
+            {
+                ASSERT_EQ(*value, iter->second);
+            }
+        }
+        }
+        ASSERT_EQ(map.size(), reference.size());
+    }
+    std::size_t visited = 0;
+    map.for_each([&](const strn::string64& key, int value) {
+        ASSERT_EQ(reference.at(key), value);
+        ++visited;
+    });
+    ASSERT_EQ(visited, reference.size());
+}
+
+TEST(flat_hash_map_tests, test_find_batch)
+{
+    strn::flat_hash_map<strn::string64, int> map;
+    std::vector<strn::string64> keys;
+    for (int i = 0; i < 1'000; ++i)
+    {
+        keys.emplace_back(std::to_string(i));
+        if (i % 3 == 0)
+            map.insert(keys.back(), i);
+    }
+    keys.emplace_back();
+    map.insert(""_s64, -1);
+    std::vector<const int*> values(keys.size());
+    const std::size_t found = map.find_batch(keys, values);
+    ASSERT_EQ(found, map.size());
+    for (std::size_t i = 0; i < keys.size(); ++i)
+        ASSERT_EQ(values[i], map.find(keys[i]));
+}
+
+TEST(flat_hash_map_tests, test_hash_policies)
+{
+    strn::flat_hash_map<strn::string32, int, strn::fibonacci_hash> fibonacci_map;
+    strn::flat_hash_map<strn::string32, int, strn::identity_hash> identity_map;
+    for (int i = 0; i < 1'000; ++i)
+    {
+        fibonacci_map.insert(strn::string32(std::to_string(i)), i);
+        identity_map.insert(strn::string32(std::to_string(i)), i);
+    }
+    for (int i = 0; i < 1'000; ++i)
+    {
+        ASSERT_EQ(*fibonacci_map.find(strn::string32(std::to_string(i))), i);
+        ASSERT_EQ(*identity_map.find(strn::string32(std::to_string(i))), i);
+    }
+}
+
+TEST(flat_hash_map_tests, test_identity_hash_probe_length)
+{
+    // The integers of string32 keys are below 2^32: without a multiply, their high bits would all be null.
+    strn::flat_hash_map<strn::string32, int, strn::identity_hash> map;
+    for (int i = 0; i < 10'000; ++i)
+        map.insert(strn::string32(std::to_string(i)), i);
+    std::size_t probes = 0, max_probes = 0;
+    for (int i = 0; i < 10'000; ++i)
+    {
+        const std::size_t key_probes = map.probe_length(strn::string32(std::to_string(i)));
+        probes += key_probes;
+        max_probes = std::max(max_probes, key_probes);
+    }
+    ASSERT_LT(probes, 2 * 10'000);
+    ASSERT_LT(max_probes, 64);
+    ASSERT_EQ(map.probe_length(""_s32), 0);
+}
+
+TEST(flat_hash_map_tests, test_std_hash_probe_length)
+{
+    // std::hash<string32> returns integer() too: its hashes are spread like those of identity_hash.
+    static_assert(!strn::has_mixed_high_bits<std::hash<strn::string32>>);
+    strn::flat_hash_map<strn::string32, int, std::hash<strn::string32>> map;
+    for (int i = 0; i < 10'000; ++i)
+        map.insert(strn::string32(std::to_string(i)), i);
+    std::size_t probes = 0, max_probes = 0;
+    for (int i = 0; i < 10'000; ++i)
+    {
+        const std::size_t key_probes = map.probe_length(strn::string32(std::to_string(i)));
+        probes += key_probes;
+        max_probes = std::max(max_probes, key_probes);
+        ASSERT_EQ(*map.find(strn::string32(std::to_string(i))), i);
+    }
+    ASSERT_LT(probes, 2 * 10'000);
+    ASSERT_LT(max_probes, 64);
+}
+
+TEST(flat_hash_map_tests, test_hash_batch)
+{
+    const std::vector<strn::string64> keys{ "a"_s64, "bc"_s64, ""_s64, "12345678"_s64 };
+    std::vector<std::size_t> hashes(keys.size());
+    strn::hash_batch<strn::string64>(keys, hashes);
+    for (std::size_t i = 0; i < keys.size(); ++i)
+        ASSERT_EQ(hashes[i], strn::mum_hash()(keys[i]));
+    strn::hash_batch<strn::string64>(keys, hashes, strn::identity_hash());
+    for (std::size_t i = 0; i < keys.size(); ++i)
+        ASSERT_EQ(hashes[i], keys[i].hash());
+}
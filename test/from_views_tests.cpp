@@ -0,0 +1,87 @@
+#include <arba/strn/from_views.hpp>
+#include <arba/strn/string32.hpp>
+#include <arba/strn/string56.hpp>
+#include <arba/strn/string64.hpp>
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+using namespace strn::literals;
+
+namespace
+{
+const std::vector<std::string> inputs{ "",        "a",        "ab",        "abc",       "abcd",
+                                       "abcde",   "abcdef",   "abcdefg",   "abcdefgh",  "abcdefghi",
+                                       "\x80\xff", "1234567890123" };
+
+template <class StringN>
+void check_same_as_constructor()
+{
+    for (const std::string& input : inputs)
+    {
+        bool truncated = true;
+        const StringN str = strn::from_view<StringN>(input, strn::truncation_policy::truncate, truncated);
+        ASSERT_EQ(str, StringN(std::string_view(input))) << input;
+        ASSERT_EQ(str.length(), std::min(input.length(), StringN::max_length())) << input;
+        ASSERT_EQ(truncated, input.length() > StringN::max_length()) << input;
+    }
+}
+} // namespace
+
+TEST(from_views_tests, test_from_view_string64)
+{
+    check_same_as_constructor<strn::string64>();
+}
+
+TEST(from_views_tests, test_from_view_string56)
+{
+    check_same_as_constructor<strn::string56>();
+}
+
+TEST(from_views_tests, test_from_view_string32)
+{
+    check_same_as_constructor<strn::string32>();
+}
+
+TEST(from_views_tests, test_from_view_no_over_read)
+{
+    // The input ends just before a character which must not be read.
+    const char buffer[] = "abcXXXXXXXX";
+    bool truncated = true;
+    ASSERT_EQ(strn::from_view<strn::string64>(std::string_view(buffer, 3), strn::truncation_policy::truncate,
+                                              truncated),
+              "abc"_s64);
+    ASSERT_FALSE(truncated);
+    ASSERT_EQ(strn::from_view<strn::string64>(std::string_view(buffer, 6), strn::truncation_policy::truncate,
+                                              truncated),
+              "abcXXX"_s64);
+}
+
+TEST(from_views_tests, test_from_views_truncate)
+{
+    const std::vector<std::string_view> views(inputs.begin(), inputs.end());
+    std::vector<strn::string64> out(views.size());
+    strn::bitmask truncated;
+    const std::size_t truncated_count = strn::from_views<strn::string64>(views, out, strn::truncation_policy::truncate,
+                                                                         &truncated);
+    ASSERT_EQ(truncated_count, 2);
+    ASSERT_EQ(truncated.size(), views.size());
+    ASSERT_EQ(truncated.count(), 2);
+    for (std::size_t i = 0; i < views.size(); ++i)
+    {
+        ASSERT_EQ(out[i], strn::string64(views[i]));
+        ASSERT_EQ(truncated[i], views[i].length() > 8);
+    }
+}
+
+TEST(from_views_tests, test_from_views_clear)
+{
+    const std::vector<std::string_view> views{ "EUR", "TOO LONG!", "USD" };
+    std::vector<strn::string32> out(views.size());
+    ASSERT_EQ(strn::from_views<strn::string32>(views, out, strn::truncation_policy::clear), 1);
+    ASSERT_EQ(out[0], "EUR"_s32);
+    ASSERT_TRUE(out[1].empty());
+    ASSERT_EQ(out[2], "USD"_s32);
+}
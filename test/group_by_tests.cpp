@@ -0,0 +1,103 @@
+#include <arba/strn/group_by.hpp>
+#include <arba/strn/string32.hpp>
+#include <arba/strn/string56.hpp>
+#include <arba/strn/string64.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <map>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace strn::literals;
+
+namespace
+{
+std::vector<strn::string64> random_symbols(std::size_t count, std::size_t distinct)
+{
+    std::mt19937_64 engine(3);
+    std::uniform_int_distribution<std::size_t> distribution(0, distinct - 1);
+    std::vector<strn::string64> symbols(count);
+    for (strn::string64& symbol : symbols)
+        symbol = strn::string64("S" + std::to_string(distribution(engine)));
+    return symbols;
+}
+} // namespace
+
+TEST(group_by_tests, test_count_by_small)
+{
+    const std::vector<strn::string32> keys{ "AAPL"_s32, "MSFT"_s32, "AAPL"_s32, ""_s32, "IBM"_s32, "AAPL"_s32 };
+    std::vector<std::pair<strn::string32, uint64_t>> counts = strn::count_by<strn::string32>(keys);
+    std::sort(counts.begin(), counts.end());
+    // Sorted in the integer() order of the keys, which is not the alphabetical order.
+    const std::map<strn::string32, uint64_t> expected{
+        { ""_s32, 1 }, { "AAPL"_s32, 3 }, { "IBM"_s32, 1 }, { "MSFT"_s32, 1 }
+    };
+    const std::vector<std::pair<strn::string32, uint64_t>> sorted_expected(expected.begin(), expected.end());
+    ASSERT_EQ(counts, sorted_expected);
+}
+
+TEST(group_by_tests, test_count_by_empty)
+{
+    ASSERT_TRUE(strn::count_by<strn::string64>(std::span<const strn::string64>()).empty());
+}
+
+TEST(group_by_tests, test_count_by_threads)
+{
+    const std::vector<strn::string64> symbols = random_symbols(500'000, 5'000);
+    std::map<strn::string64, uint64_t> expected;
+    for (const strn::string64& symbol : symbols)
+        ++expected[symbol];
+    for (std::size_t thread_count : { 1, 3, 8 })
+    {
+        const std::vector<std::pair<strn::string64, uint64_t>> counts
+            = strn::count_by<strn::string64>(symbols, thread_count);
+        ASSERT_EQ(counts.size(), expected.size());
+        for (const auto& [symbol, count] : counts)
+            ASSERT_EQ(count, expected.at(symbol)) << symbol.to_string();
+    }
+}
+
+TEST(group_by_tests, test_aggregate_by)
+{
+    const std::vector<strn::string64> symbols = random_symbols(300'000, 1'000);
+    std::vector<uint64_t> volumes(symbols.size());
+    for (std::size_t i = 0; i < volumes.size(); ++i)
+        volumes[i] = i % 977;
+    std::map<strn::string64, uint64_t> expected_sums, expected_maxima;
+    for (std::size_t i = 0; i < symbols.size(); ++i)
+    {
+        expected_sums[symbols[i]] += volumes[i];
+        expected_maxima[symbols[i]] = std::max(expected_maxima[symbols[i]], volumes[i]);
+    }
+
+    const auto sums = strn::aggregate_by<strn::string64, uint64_t>(symbols, volumes, std::plus<>(), 4);
+    ASSERT_EQ(sums.size(), expected_sums.size());
+    for (const auto& [symbol, sum] : sums)
+        ASSERT_EQ(sum, expected_sums.at(symbol));
+
+    const auto maxima = strn::aggregate_by<strn::string64, uint64_t>(
+        symbols, volumes, [](uint64_t lhs, uint64_t rhs) { return std::max(lhs, rhs); }, 4);
+    ASSERT_EQ(maxima.size(), expected_maxima.size());
+    for (const auto& [symbol, maximum] : maxima)
+        ASSERT_EQ(maximum, expected_maxima.at(symbol));
+}
+
+TEST(group_by_tests, test_aggregate_by_shorter_values)
+{
+    const std::vector<strn::string56> keys{ "A"_s56, "B"_s56, "A"_s56 };
+    const std::vector<double> prices{ 1.5, 2.5 };
+    const auto sums = strn::aggregate_by<strn::string56, double>(keys, prices);
+    ASSERT_EQ(sums.size(), 2);
+}
+
+TEST(group_by_tests, test_aggregate_by_exception)
+{
+    const std::vector<strn::string64> symbols = random_symbols(300'000, 10);
+    const std::vector<int> values(symbols.size(), 1);
+    const auto throwing = [](int, int) -> int { throw std::runtime_error("op"); };
+    ASSERT_THROW((strn::aggregate_by<strn::string64, int>(symbols, values, throwing, 4)), std::runtime_error);
+}
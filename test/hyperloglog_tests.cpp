@@ -0,0 +1,61 @@
+#include <arba/strn/hyperloglog.hpp>
+#include <arba/strn/string32.hpp>
+#include <arba/strn/string64.hpp>
+
+#include <gtest/gtest.h>
+
+#include "test_keys.hpp"
+
+#include <cmath>
+#include <string>
+#include <vector>
+
+using namespace strn::literals;
+using test_keys::make_keys;
+
+TEST(hyperloglog_tests, test_empty)
+{
+    strn::hyperloglog<strn::string64> sketch;
+    ASSERT_EQ(sketch.estimate(), 0);
+    ASSERT_EQ(sketch.size_in_bytes(), 1 << 14);
+}
+
+TEST(hyperloglog_tests, test_duplicates)
+{
+    strn::hyperloglog<strn::string32> sketch;
+    for (int i = 0; i < 1000; ++i)
+    {
+        sketch.add("AAPL"_s32);
+        sketch.add("MSFT"_s32);
+        sketch.add(""_s32);
+    }
+    ASSERT_NEAR(sketch.estimate(), 3, 0.01);
+    sketch.clear();
+    ASSERT_EQ(sketch.estimate(), 0);
+}
+
+TEST(hyperloglog_tests, test_estimate)
+{
+    for (std::size_t count : { 1'000, 50'000, 1'000'000 })
+    {
+        const std::vector<strn::string64> keys = make_keys(count, "K");
+        strn::hyperloglog<strn::string64> sketch;
+        sketch.add(keys);
+        sketch.add(keys);
+        const double relative_error = std::abs(sketch.estimate() - double(count)) / double(count);
+        ASSERT_LT(relative_error, 4 * sketch.standard_error()) << count;
+    }
+}
+
+TEST(hyperloglog_tests, test_merge)
+{
+    const std::vector<strn::string64> keys = make_keys(200'000, "K");
+    const std::span<const strn::string64> all(keys);
+    strn::hyperloglog<strn::string64> whole, first_half, second_half;
+    whole.add(all);
+    // The halves overlap: the union has keys.size() distinct keys.
+    first_half.add(all.first(120'000));
+    second_half.add(all.last(120'000));
+    first_half.merge(second_half);
+    ASSERT_EQ(first_half.estimate(), whole.estimate());
+}
@@ -0,0 +1,102 @@
+#include <arba/strn/key_pair.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <format>
+#include <unordered_map>
+#include <vector>
+
+using namespace strn::literals;
+
+using venue_symbol = strn::key_pair<strn::string64, strn::string64>;
+
+static_assert(sizeof(venue_symbol) == 16);
+static_assert(alignof(venue_symbol) == 16);
+static_assert(sizeof(strn::key_pair<strn::string32, strn::string64>) == 16);
+static_assert(sizeof(strn::key_pair<strn::string56, strn::string32>) == 16);
+static_assert(std::is_trivially_copyable_v<venue_symbol>);
+
+static_assert(venue_symbol("XNAS"_s64, "AAPL"_s64).first() == "XNAS"_s64);
+static_assert(venue_symbol("XNAS"_s64, "AAPL"_s64).second() == "AAPL"_s64);
+static_assert(venue_symbol("XNAS"_s64, "AAPL"_s64) == venue_symbol("XNAS"_s64, "AAPL"_s64));
+static_assert(venue_symbol("XNAS"_s64, "AAPL"_s64) < venue_symbol("XNAS"_s64, "MSFT"_s64));
+static_assert(venue_symbol("XNAS"_s64, "AAPL"_s64).hash() == venue_symbol("XNAS"_s64, "AAPL"_s64).hash());
+
+TEST(key_pair_tests, test_default)
+{
+    venue_symbol key;
+    ASSERT_TRUE(key.first().empty());
+    ASSERT_TRUE(key.second().empty());
+    ASSERT_EQ(key, venue_symbol(strn::string64(), strn::string64()));
+}
+
+TEST(key_pair_tests, test_accessors)
+{
+    strn::key_pair key("ORDE"_s32, "CLIENT_I"_s64);
+    static_assert(std::is_same_v<decltype(key), strn::key_pair<strn::string32, strn::string64>>);
+    ASSERT_EQ(key.first(), "ORDE"_s32);
+    ASSERT_EQ(key.second(), "CLIENT_I"_s64);
+
+    strn::key_pair<strn::string56, strn::string32> mixed("NAME567"_s56, "ID"_s32);
+    ASSERT_EQ(mixed.first(), "NAME567"_s56);
+    ASSERT_EQ(mixed.first().length(), 7);
+    ASSERT_EQ(mixed.second(), "ID"_s32);
+}
+
+TEST(key_pair_tests, test_equality)
+{
+    const venue_symbol key("XNAS"_s64, "AAPL"_s64);
+    ASSERT_EQ(key, venue_symbol("XNAS"_s64, "AAPL"_s64));
+    ASSERT_NE(key, venue_symbol("XNYS"_s64, "AAPL"_s64));
+    ASSERT_NE(key, venue_symbol("XNAS"_s64, "AAPM"_s64));
+    ASSERT_NE(key, venue_symbol("AAPL"_s64, "XNAS"_s64));
+}
+
+TEST(key_pair_tests, test_order)
+{
+    std::vector<venue_symbol> keys{ { "XNYS"_s64, "IBM"_s64 },
+                                    { "XNAS"_s64, "MSFT"_s64 },
+                                    { "XNAS"_s64, "AAPL"_s64 },
+                                    { "XNYS"_s64, "GE"_s64 } };
+    std::vector<std::pair<strn::string64, strn::string64>> pairs;
+    for (const venue_symbol& key : keys)
+        pairs.emplace_back(key.first(), key.second());
+    std::ranges::sort(keys);
+    std::ranges::sort(pairs);
+    for (std::size_t i = 0; i < keys.size(); ++i)
+    {
+        ASSERT_EQ(keys[i].first(), pairs[i].first);
+        ASSERT_EQ(keys[i].second(), pairs[i].second);
+    }
+    ASSERT_TRUE((venue_symbol("XNAS"_s64, "AAPL"_s64) <=> venue_symbol("XNAS"_s64, "AAPL"_s64)) == 0);
+}
+
+TEST(key_pair_tests, test_hash)
+{
+    const venue_symbol key("XNAS"_s64, "AAPL"_s64);
+    ASSERT_EQ(std::hash<venue_symbol>()(key), key.hash());
+    ASSERT_NE(key.hash(), venue_symbol("AAPL"_s64, "XNAS"_s64).hash());
+    ASSERT_NE(key.hash(), venue_symbol("XNAS"_s64, "MSFT"_s64).hash());
+    ASSERT_NE(venue_symbol("A"_s64, "A"_s64).hash(), venue_symbol().hash());
+}
+
+TEST(key_pair_tests, test_unordered_map)
+{
+    std::unordered_map<venue_symbol, int> prices;
+    prices[{ "XNAS"_s64, "AAPL"_s64 }] = 1;
+    prices[{ "XNAS"_s64, "MSFT"_s64 }] = 2;
+    prices[{ "XNYS"_s64, "AAPL"_s64 }] = 3;
+    ASSERT_EQ(prices.size(), 3);
+    ASSERT_EQ(prices.at({ "XNAS"_s64, "MSFT"_s64 }), 2);
+    ASSERT_EQ(prices.at({ "XNYS"_s64, "AAPL"_s64 }), 3);
+    ASSERT_FALSE(prices.contains({ "XNYS"_s64, "MSFT"_s64 }));
+}
+
+TEST(key_pair_tests, test_format)
+{
+    const strn::key_pair key("XNAS"_s32, "AAPL"_s64);
+    ASSERT_EQ(std::format("{}", key), "XNAS/AAPL");
+    ASSERT_EQ(std::format("{:q}", key), "\"XNAS\"/\"AAPL\"");
+    ASSERT_EQ(std::format("{:L}", key), "xnas/aapl");
+}
@@ -0,0 +1,148 @@
+#include <arba/strn/mapped_table.hpp>
+#include <arba/strn/string32.hpp>
+#include <arba/strn/string64.hpp>
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <system_error>
+
+using namespace strn::literals;
+
+namespace
+{
+class mapped_table_tests : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        const std::string name = ::testing::UnitTest::GetInstance()->current_test_info()->name();
+        path_ = std::filesystem::temp_directory_path() / ("strn_mapped_table_tests_" + name + ".strnmt");
+    }
+
+    void TearDown() override { std::filesystem::remove(path_); }
+
+    // Write a valid table of 10 keys, then overwrite its header with the one modify_header returns.
+    template <class ModifyHeader>
+    void write_corrupted_table(const ModifyHeader& modify_header)
+    {
+        strn::mapped_table_builder<strn::string64, uint64_t> builder;
+        for (uint64_t i = 0; i < 10; ++i)
+            builder.insert_or_assign(strn::string64(std::to_string(i)), i);
+        builder.write(path_);
+        strn::mapped_table_header header;
+        {
+            std::ifstream stream(path_, std::ios::binary);
+            stream.read(reinterpret_cast<char*>(&header), sizeof(header));
+        }
+        header = modify_header(header);
+        std::fstream stream(path_, std::ios::binary | std::ios::in | std::ios::out);
+        stream.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    }
+
+    std::filesystem::path path_;
+};
+} // namespace
+
+TEST_F(mapped_table_tests, test_build_and_find)
+{
+    strn::mapped_table_builder<strn::string64, uint64_t> builder;
+    for (uint64_t i = 0; i < 10'000; ++i)
+        builder.insert_or_assign(strn::string64(std::to_string(i)), i);
+    builder.insert_or_assign("42"_s64, 4242);
+    builder.insert_or_assign(""_s64, 6);
+    builder.insert_or_assign(""_s64, 7);
+    ASSERT_EQ(builder.size(), 10'001);
+    builder.write(path_);
+
+    const strn::mapped_table<strn::string64, uint64_t> table(path_);
+    ASSERT_EQ(table.size(), 10'001);
+    ASSERT_GE(table.capacity(), 2 * table.size());
+    for (uint64_t i = 0; i < 10'000; ++i)
+    {
+        const uint64_t* value = table.find(strn::string64(std::to_string(i)));
+        ASSERT_NE(value, nullptr);
+        ASSERT_EQ(*value, i == 42 ? 4242 : i);
+    }
+    ASSERT_EQ(*table.find(""_s64), 7);
+    ASSERT_EQ(table.find("-1"_s64), nullptr);
+    ASSERT_FALSE(table.contains("10000"_s64));
+}
+
+TEST_F(mapped_table_tests, test_empty_table)
+{
+    strn::mapped_table_builder<strn::string32, double> builder;
+    builder.write(path_);
+    const strn::mapped_table<strn::string32, double> table(path_);
+    ASSERT_TRUE(table.empty());
+    ASSERT_EQ(table.find("EUR"_s32), nullptr);
+    ASSERT_EQ(table.find(""_s32), nullptr);
+}
+
+TEST_F(mapped_table_tests, test_type_mismatch)
+{
+    strn::mapped_table_builder<strn::string64, uint64_t> builder;
+    builder.insert_or_assign("A"_s64, 1);
+    builder.write(path_);
+    using bad_table = strn::mapped_table<strn::string64, uint32_t>;
+    ASSERT_THROW(bad_table table(path_), std::runtime_error);
+}
+
+TEST_F(mapped_table_tests, test_bad_file)
+{
+    std::ofstream(path_) << "not a table";
+    using table_type = strn::mapped_table<strn::string64, uint64_t>;
+    ASSERT_THROW(table_type table(path_), std::runtime_error);
+    ASSERT_THROW(table_type table(path_.string() + ".missing"), std::system_error);
+}
+
+TEST_F(mapped_table_tests, test_corrupted_header)
+{
+    using table_type = strn::mapped_table<strn::string64, uint64_t>;
+    using header_type = strn::mapped_table_header;
+
+    write_corrupted_table([](header_type header) { return header; });
+    ASSERT_NO_THROW(table_type table(path_));
+
+    // capacity * sizeof(Key) wraps to 0.
+    write_corrupted_table([](header_type header) {
+        header.capacity = uint64_t(1) << 62;
+        return header;
+    });
+    ASSERT_THROW(table_type table(path_), std::runtime_error);
+
+    // keys_offset + capacity * sizeof(Key) wraps.
+    write_corrupted_table([](header_type header) {
+        header.keys_offset = ~uint64_t(63);
+        return header;
+    });
+    ASSERT_THROW(table_type table(path_), std::runtime_error);
+
+    write_corrupted_table([](header_type header) {
+        header.keys_offset = 0;
+        return header;
+    });
+    ASSERT_THROW(table_type table(path_), std::runtime_error);
+
+    write_corrupted_table([](header_type header) {
+        header.values_offset = header.keys_offset;
+        return header;
+    });
+    ASSERT_THROW(table_type table(path_), std::runtime_error);
+
+    // No empty key slot: a lookup of a missing key would never end.
+    write_corrupted_table([](header_type header) {
+        header.size = header.capacity;
+        return header;
+    });
+    ASSERT_THROW(table_type table(path_), std::runtime_error);
+
+    write_corrupted_table([](header_type header) {
+        header.has_empty_key = 1;
+        header.size = 0;
+        return header;
+    });
+    ASSERT_THROW(table_type table(path_), std::runtime_error);
+}
@@ -0,0 +1,127 @@
+#include <arba/strn/packed_array.hpp>
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace strn::literals;
+
+namespace
+{
+template <class PackedArray>
+std::vector<strn::string64> random_values(std::size_t count, std::string_view alphabet)
+{
+    std::mt19937_64 engine(7);
+    std::uniform_int_distribution<std::size_t> length_distribution(0, PackedArray::max_length());
+    std::uniform_int_distribution<std::size_t> char_distribution(0, alphabet.size() - 1);
+    std::vector<strn::string64> values(count);
+    for (strn::string64& value : values)
+    {
+        std::string text(length_distribution(engine), ' ');
+        for (char& ch : text)
+            ch = alphabet[char_distribution(engine)];
+        value = strn::string64(text);
+    }
+    return values;
+}
+
+template <class PackedArray>
+void check_round_trip(std::string_view alphabet)
+{
+    const std::vector<strn::string64> values = random_values<PackedArray>(1001, alphabet);
+    PackedArray array;
+    array.append(values);
+    ASSERT_EQ(array.size(), values.size());
+    for (std::size_t i = 0; i < values.size(); ++i)
+        ASSERT_EQ(array[i], values[i]) << i;
+    for (std::size_t first : { 0, 1, 3, 998 })
+    {
+        std::vector<strn::string64> unpacked(values.size());
+        const std::size_t count = array.unpack(first, unpacked);
+        ASSERT_EQ(count, values.size() - first);
+        for (std::size_t i = 0; i < count; ++i)
+            ASSERT_EQ(unpacked[i], values[first + i]) << first << " " << i;
+    }
+}
+
+constexpr std::string_view sixbit_alphabet = "!\"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\\]^_";
+} // namespace
+
+static_assert(strn::packed_array<40>::max_length() == 5);
+static_assert(strn::packed_array<36, strn::sixbit_codec>::max_length() == 6);
+
+TEST(packed_array_tests, test_empty)
+{
+    strn::packed_array<40> array;
+    ASSERT_TRUE(array.empty());
+    std::vector<strn::string64> unpacked(4);
+    ASSERT_EQ(array.unpack(0, unpacked), 0);
+    ASSERT_EQ(array.unpack(5, unpacked), 0);
+}
+
+TEST(packed_array_tests, test_push_back)
+{
+    strn::packed_array<40> array;
+    array.push_back("AAPL"_s64);
+    array.push_back("MSFT"_s64);
+    array.push_back(""_s64);
+    array.push_back("ABCDE"_s64);
+    ASSERT_EQ(array.size(), 4);
+    ASSERT_EQ(array[0], "AAPL"_s64);
+    ASSERT_EQ(array[1], "MSFT"_s64);
+    ASSERT_EQ(array[2], ""_s64);
+    ASSERT_EQ(array[3], "ABCDE"_s64);
+    ASSERT_EQ(array[3].length(), 5);
+}
+
+TEST(packed_array_tests, test_cannot_store)
+{
+    strn::packed_array<40> array;
+    ASSERT_FALSE(array.can_store("ABCDEF"_s64));
+    ASSERT_THROW(array.push_back("ABCDEF"_s64), std::invalid_argument);
+    strn::packed_array<36, strn::sixbit_codec> sixbit_array;
+    ASSERT_TRUE(sixbit_array.can_store("AB_9"_s64));
+    ASSERT_FALSE(sixbit_array.can_store("abc"_s64));
+    ASSERT_FALSE(sixbit_array.can_store("A B"_s64));
+    ASSERT_THROW(sixbit_array.push_back("abc"_s64), std::invalid_argument);
+    ASSERT_TRUE(sixbit_array.empty());
+}
+
+TEST(packed_array_tests, test_sixbit_codec)
+{
+    for (const strn::string64 value : { ""_s64, "A"_s64, "!"_s64, "__"_s64, "ZZZZZZZZ"_s64, "AZ09!_?@"_s64 })
+    {
+        const uint64_t chars = value.integer();
+        ASSERT_LT(strn::sixbit_codec::encode(chars), uint64_t(1) << 48);
+        ASSERT_EQ(strn::sixbit_codec::decode(strn::sixbit_codec::encode(chars)), chars);
+    }
+}
+
+TEST(packed_array_tests, test_storage_size)
+{
+    strn::packed_array<40> array;
+    for (std::size_t i = 0; i < 1000; ++i)
+        array.push_back("XNAS"_s64);
+    ASSERT_EQ(array.storage_size(), 1000 * 40 / 8 + 8);
+    array.clear();
+    ASSERT_TRUE(array.empty());
+}
+
+TEST(packed_array_tests, test_round_trip_byte_codec)
+{
+    check_round_trip<strn::packed_array<8>>("ABCXYZ");
+    check_round_trip<strn::packed_array<24>>("ABCXYZ");
+    check_round_trip<strn::packed_array<40>>("ABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789");
+    check_round_trip<strn::packed_array<56>>("abc\x7f\x80\xff");
+}
+
+TEST(packed_array_tests, test_round_trip_sixbit_codec)
+{
+    check_round_trip<strn::packed_array<18, strn::sixbit_codec>>(sixbit_alphabet);
+    check_round_trip<strn::packed_array<30, strn::sixbit_codec>>(sixbit_alphabet);
+    check_round_trip<strn::packed_array<36, strn::sixbit_codec>>(sixbit_alphabet);
+    check_round_trip<strn::packed_array<48, strn::sixbit_codec>>(sixbit_alphabet);
+}
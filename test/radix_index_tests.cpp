@@ -0,0 +1,215 @@
+#include <arba/strn/radix_index.hpp>
+#include <arba/strn/string32.hpp>
+#include <arba/strn/string56.hpp>
+#include <arba/strn/string64.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <map>
+#include <new>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace strn::literals;
+
+namespace
+{
+template <class Key>
+std::vector<std::string> visited_keys(const strn::radix_index<Key, int>& index)
+{
+    std::vector<std::string> keys;
+    index.for_each([&](const Key& key, int) { keys.push_back(key.to_string()); });
+    return keys;
+}
+
+// The number of allocations left before operator new throws std::bad_alloc, or -1 for no limit.
+int allocations_before_failure = -1;
+
+// A value counting its live instances, to detect the leaked leaves.
+struct counted_value
+{
+    inline static int live_count = 0;
+
+    explicit counted_value(int v) : value(v) { ++live_count; }
+    counted_value(counted_value&& other) : value(other.value) { ++live_count; }
+    ~counted_value() { --live_count; }
+
+    int value;
+};
+} // namespace
+
+void* operator new(std::size_t size)
+{
+    if (allocations_before_failure == 0)
+        throw std::bad_alloc();
+    if (allocations_before_failure > 0)
+        --allocations_before_failure;
+    if (void* pointer = std::malloc(size == 0 ? 1 : size))
+        return pointer;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* pointer) noexcept
+{
+    std::free(pointer);
+}
+
+void operator delete(void* pointer, std::size_t) noexcept
+{
+    std::free(pointer);
+}
+
+TEST(radix_index_tests, test_empty)
+{
+    strn::radix_index<strn::string64, int> index;
+    ASSERT_TRUE(index.empty());
+    ASSERT_EQ(index.size(), 0);
+    ASSERT_EQ(index.find("AB"_s64), nullptr);
+    ASSERT_TRUE(visited_keys(index).empty());
+}
+
+TEST(radix_index_tests, test_insert_find)
+{
+    strn::radix_index<strn::string64, int> index;
+    ASSERT_TRUE(index.insert("ABC"_s64, 1).second);
+    ASSERT_TRUE(index.insert("ABD"_s64, 2).second);
+    ASSERT_TRUE(index.insert("AB"_s64, 3).second);
+    ASSERT_TRUE(index.insert(""_s64, 4).second);
+    ASSERT_TRUE(index.insert("ABCDEFGH"_s64, 5).second);
+    auto [value, inserted] = index.insert("ABC"_s64, 10);
+    ASSERT_FALSE(inserted);
+    ASSERT_EQ(*value, 1);
+    ASSERT_EQ(index.size(), 5);
+    ASSERT_EQ(*index.find("ABC"_s64), 1);
+    ASSERT_EQ(*index.find("ABD"_s64), 2);
+    ASSERT_EQ(*index.find("AB"_s64), 3);
+    ASSERT_EQ(*index.find(""_s64), 4);
+    ASSERT_EQ(*index.find("ABCDEFGH"_s64), 5);
+    ASSERT_EQ(index.find("A"_s64), nullptr);
+    ASSERT_EQ(index.find("ABCDEFGI"_s64), nullptr);
+    ASSERT_FALSE(index.insert_or_assign("ABC"_s64, 11));
+    ASSERT_EQ(*index.find("ABC"_s64), 11);
+    index.clear();
+    ASSERT_TRUE(index.empty());
+    ASSERT_FALSE(index.contains("ABC"_s64));
+}
+
+TEST(radix_index_tests, test_ordered_iteration)
+{
+    strn::radix_index<strn::string64, int> index;
+    for (const char* key : { "bb", "aaa", "b", "ab", "a", "zz", "BA" })
+        index.insert(strn::string64(std::string_view(key)), 0);
+    const std::vector<std::string> expected{ "BA", "a", "aaa", "ab", "b", "bb", "zz" };
+    ASSERT_EQ(visited_keys(index), expected);
+}
+
+TEST(radix_index_tests, test_node_growth)
+{
+    // Enough random keys to grow nodes up to node256, checked against std::map in alphabetical order.
+    std::mt19937_64 engine(42);
+    std::uniform_int_distribution<int> length_dist(0, 8), char_dist(1, 255);
+    strn::radix_index<strn::string64, int> index;
+    std::map<std::string, int> reference;
+    for (int i = 0; i < 20'000; ++i)
+    {
+        std::string str(length_dist(engine), ' ');
+        for (char& ch : str)
+            ch = static_cast<char>(char_dist(engine));
+        const bool inserted = index.insert(strn::string64(str), i).second;
+        ASSERT_EQ(inserted, reference.emplace(str, i).second);
+    }
+    ASSERT_EQ(index.size(), reference.size());
+    for (const auto& [str, value] : reference)
+        ASSERT_EQ(*index.find(strn::string64(str)), value);
+    std::vector<std::string> expected;
+    for (const auto& entry : reference)
+        expected.push_back(entry.first);
+    ASSERT_EQ(visited_keys(index), expected);
+}
+
+TEST(radix_index_tests, test_insert_allocation_failure)
+{
+    // "ABCD" shares three bytes with the leaf "ABCX": its insertion allocates a leaf and four node4s. "X1" then
+    // grows the full root node4 into a node16.
+    for (int failure = 0; failure < 6; ++failure)
+    {
+        {
+            strn::radix_index<strn::string64, counted_value> index;
+            for (const char* key : { "ABCX", "B", "C", "D" })
+                index.insert(strn::string64(std::string_view(key)), counted_value(0));
+            for (const char* key : { "ABCD", "X1" })
+            {
+                allocations_before_failure = failure;
+                bool inserted = false;
+                try
+                {
+                    inserted = index.insert(strn::string64(std::string_view(key)), counted_value(1)).second;
+                }
+                catch (const std::bad_alloc&)
+                {
+                }
+                allocations_before_failure = -1;
+                ASSERT_EQ(index.contains(strn::string64(std::string_view(key))), inserted) << failure;
+            }
+            std::size_t visited = 0;
+            index.for_each([&](const strn::string64&, const counted_value&) { ++visited; });
+            ASSERT_EQ(visited, index.size()) << failure;
+            ASSERT_NE(index.find("ABCX"_s64), nullptr) << failure;
+            ASSERT_EQ(counted_value::live_count, int(index.size())) << failure;
+        }
+        ASSERT_EQ(counted_value::live_count, 0) << failure;
+    }
+}
+
+TEST(radix_index_tests, test_prefix_scan)
+{
+    strn::radix_index<strn::string64, int> index;
+    for (const char* key : { "AB", "ABC", "ABCD", "AC", "B", "A" })
+        index.insert(strn::string64(std::string_view(key)), 0);
+    std::vector<std::string> keys;
+    index.prefix_scan("AB", [&](const strn::string64& key, int) { keys.push_back(key.to_string()); });
+    ASSERT_EQ(keys, (std::vector<std::string>{ "AB", "ABC", "ABCD" }));
+    keys.clear();
+    index.prefix_scan("ABCD", [&](const strn::string64& key, int) { keys.push_back(key.to_string()); });
+    ASSERT_EQ(keys, (std::vector<std::string>{ "ABCD" }));
+    keys.clear();
+    index.prefix_scan("X", [&](const strn::string64& key, int) { keys.push_back(key.to_string()); });
+    ASSERT_TRUE(keys.empty());
+    index.prefix_scan("", [&](const strn::string64& key, int) { keys.push_back(key.to_string()); });
+    ASSERT_EQ(keys.size(), index.size());
+}
+
+TEST(radix_index_tests, test_range_scan)
+{
+    strn::radix_index<strn::string64, int> index;
+    for (const char* key : { "A", "AA", "AB", "B", "BA", "C" })
+        index.insert(strn::string64(std::string_view(key)), 0);
+    std::vector<std::string> keys;
+    index.range_scan("AA"_s64, "BA"_s64, [&](const strn::string64& key, int) { keys.push_back(key.to_string()); });
+    ASSERT_EQ(keys, (std::vector<std::string>{ "AA", "AB", "B" }));
+    keys.clear();
+    index.range_scan("C"_s64, "A"_s64, [&](const strn::string64& key, int) { keys.push_back(key.to_string()); });
+    ASSERT_TRUE(keys.empty());
+}
+
+TEST(radix_index_tests, test_mutable_for_each)
+{
+    strn::radix_index<strn::string32, int> index;
+    index.insert("EUR"_s32, 1);
+    index.insert("USD"_s32, 2);
+    index.for_each([](const strn::string32&, int& value) { value *= 10; });
+    ASSERT_EQ(*index.find("EUR"_s32), 10);
+    ASSERT_EQ(*index.find("USD"_s32), 20);
+}
+
+TEST(radix_index_tests, test_string56)
+{
+    strn::radix_index<strn::string56, int> index;
+    index.insert("b"_s56, 1);
+    index.insert("ab"_s56, 2);
+    index.insert("abc"_s56, 3);
+    ASSERT_EQ(visited_keys(index), (std::vector<std::string>{ "ab", "abc", "b" }));
+}
@@ -0,0 +1,108 @@
+#include <arba/strn/set_operations.hpp>
+#include <arba/strn/string32.hpp>
+#include <arba/strn/string56.hpp>
+#include <arba/strn/string64.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <iterator>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace strn::literals;
+
+namespace
+{
+// A sorted set of size distinct values drawn among range values.
+template <class StringN>
+std::vector<StringN> random_set(std::mt19937_64& engine, std::size_t size, std::size_t range)
+{
+    std::vector<StringN> values;
+    std::uniform_int_distribution<std::size_t> distribution(0, range - 1);
+    for (std::size_t i = 0; i < size; ++i)
+        values.push_back(StringN(std::to_string(distribution(engine))));
+    std::sort(values.begin(), values.end());
+    values.erase(std::unique(values.begin(), values.end()), values.end());
+    return values;
+}
+
+template <class StringN>
+void check_operations(const std::vector<StringN>& lhs, const std::vector<StringN>& rhs)
+{
+    std::vector<StringN> expected;
+    std::vector<StringN> out(lhs.size() + rhs.size());
+
+    std::set_intersection(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(), std::back_inserter(expected));
+    std::size_t count = strn::set_intersection<StringN>(lhs, rhs, out);
+    ASSERT_EQ(std::vector<StringN>(out.begin(), out.begin() + count), expected);
+
+    std::vector<std::pair<std::size_t, std::size_t>> pairs;
+    strn::merge_join<StringN>(lhs, rhs, [&](std::size_t i, std::size_t j) { pairs.emplace_back(i, j); });
+    ASSERT_EQ(pairs.size(), expected.size());
+    for (std::size_t k = 0; k < pairs.size(); ++k)
+    {
+        ASSERT_EQ(lhs[pairs[k].first], expected[k]);
+        ASSERT_EQ(rhs[pairs[k].second], expected[k]);
+    }
+
+    expected.clear();
+    std::set_union(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(), std::back_inserter(expected));
+    count = strn::set_union<StringN>(lhs, rhs, out);
+    ASSERT_EQ(std::vector<StringN>(out.begin(), out.begin() + count), expected);
+
+    expected.clear();
+    std::set_difference(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(), std::back_inserter(expected));
+    count = strn::set_difference<StringN>(lhs, rhs, out);
+    ASSERT_EQ(std::vector<StringN>(out.begin(), out.begin() + count), expected);
+}
+
+template <class StringN>
+void check_random_operations()
+{
+    std::mt19937_64 engine(11);
+    const std::pair<std::size_t, std::size_t> sizes[]
+        = { { 0, 0 }, { 0, 10 }, { 1, 1 }, { 3, 5 }, { 100, 100 }, { 1000, 1500 }, { 20, 5000 }, { 5000, 20 } };
+    for (const auto& [lhs_size, rhs_size] : sizes)
+    {
+        for (std::size_t range : { std::size_t(50), std::size_t(2000), std::size_t(100000) })
+        {
+            const std::vector<StringN> lhs = random_set<StringN>(engine, lhs_size, range);
+            const std::vector<StringN> rhs = random_set<StringN>(engine, rhs_size, range);
+            check_operations(lhs, rhs);
+            check_operations(rhs, lhs);
+            check_operations(lhs, lhs);
+        }
+    }
+}
+} // namespace
+
+TEST(set_operations_tests, test_small)
+{
+    const std::vector<strn::string64> lhs{ "A"_s64, "B"_s64, "C"_s64, "D"_s64 };
+    std::vector<strn::string64> rhs{ "B"_s64, "D"_s64, "E"_s64 };
+    std::sort(rhs.begin(), rhs.end());
+    std::vector<strn::string64> sorted_lhs = lhs;
+    std::sort(sorted_lhs.begin(), sorted_lhs.end());
+    std::vector<strn::string64> out(7);
+    ASSERT_EQ(strn::set_intersection<strn::string64>(sorted_lhs, rhs, out), 2);
+    ASSERT_EQ(strn::set_union<strn::string64>(sorted_lhs, rhs, out), 5);
+    ASSERT_EQ(strn::set_difference<strn::string64>(sorted_lhs, rhs, out), 2);
+}
+
+TEST(set_operations_tests, test_random_string32)
+{
+    check_random_operations<strn::string32>();
+}
+
+TEST(set_operations_tests, test_random_string56)
+{
+    check_random_operations<strn::string56>();
+}
+
+TEST(set_operations_tests, test_random_string64)
+{
+    check_random_operations<strn::string64>();
+}
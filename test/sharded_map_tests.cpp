@@ -0,0 +1,103 @@
+#include <arba/strn/sharded_map.hpp>
+#include <arba/strn/string64.hpp>
+
+#include <gtest/gtest.h>
+
+#include "test_keys.hpp"
+
+#include <atomic>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace strn::literals;
+using test_keys::make_keys;
+
+TEST(sharded_map_tests, test_empty)
+{
+    strn::sharded_map<strn::string64, int> map;
+    ASSERT_EQ(map.shard_count(), 64);
+    ASSERT_TRUE(map.empty());
+    ASSERT_FALSE(map.find("AAPL"_s64).has_value());
+    ASSERT_FALSE(map.contains(""_s64));
+}
+
+TEST(sharded_map_tests, test_insert_find_erase)
+{
+    strn::sharded_map<strn::string64, int, 8> map(100);
+    ASSERT_TRUE(map.insert("AAPL"_s64, 1));
+    ASSERT_FALSE(map.insert("AAPL"_s64, 2));
+    ASSERT_EQ(map.find("AAPL"_s64), 1);
+    ASSERT_FALSE(map.insert_or_assign("AAPL"_s64, 3));
+    ASSERT_TRUE(map.insert_or_assign(""_s64, 4));
+    ASSERT_EQ(map.find("AAPL"_s64), 3);
+    ASSERT_EQ(map.find(""_s64), 4);
+    ASSERT_EQ(map.size(), 2);
+
+    int visited = 0;
+    ASSERT_TRUE(map.visit("AAPL"_s64, [&](const int& value) { visited = value; }));
+    ASSERT_EQ(visited, 3);
+    ASSERT_FALSE(map.visit("MSFT"_s64, [&](const int&) { visited = -1; }));
+    ASSERT_EQ(visited, 3);
+
+    map.update("MSFT"_s64, [](int& value) { value += 5; });
+    map.update("MSFT"_s64, [](int& value) { value += 5; });
+    ASSERT_EQ(map.find("MSFT"_s64), 10);
+
+    ASSERT_TRUE(map.erase("AAPL"_s64));
+    ASSERT_FALSE(map.erase("AAPL"_s64));
+    ASSERT_FALSE(map.contains("AAPL"_s64));
+    map.clear();
+    ASSERT_TRUE(map.empty());
+}
+
+TEST(sharded_map_tests, test_concurrent_updates)
+{
+    const std::vector<strn::string64> keys = make_keys(1'000, "K");
+    strn::sharded_map<strn::string64, uint64_t> map;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 8; ++t)
+    {
+        threads.emplace_back([&] {
+            for (int round = 0; round < 10; ++round)
+                for (const strn::string64& key : keys)
+                {
+                    map.update(key, [](uint64_t& value) { ++value; });
+                    ASSERT_TRUE(map.contains(key));
+                }
+        });
+    }
+    for (std::thread& thread : threads)
+        thread.join();
+    ASSERT_EQ(map.size(), keys.size());
+    for (const strn::string64& key : keys)
+        ASSERT_EQ(map.find(key), 80);
+}
+
+TEST(sharded_map_tests, test_for_each_shard)
+{
+    const std::vector<strn::string64> keys = make_keys(10'000, "K");
+    strn::sharded_map<strn::string64, uint64_t, 16> map;
+    for (std::size_t i = 0; i < keys.size(); ++i)
+        map.insert(keys[i], i);
+
+    std::atomic<std::size_t> shards = 0, count = 0, max_shard_size = 0;
+    map.for_each_shard([&](const auto& table) {
+        ++shards;
+        count += table.size();
+        std::size_t size = max_shard_size;
+        while (size < table.size() && !max_shard_size.compare_exchange_weak(size, table.size()))
+            ;
+    });
+    ASSERT_EQ(shards, 16);
+    ASSERT_EQ(count, keys.size());
+    // The keys are spread evenly over the shards.
+    ASSERT_LT(max_shard_size, 2 * keys.size() / 16);
+
+    map.for_each_shard([](auto& table) { table.for_each([](const strn::string64&, uint64_t& value) { value *= 2; }); },
+                       4);
+    ASSERT_EQ(map.find(keys[21]), 42);
+
+    ASSERT_THROW(map.for_each_shard([](const auto&) { throw std::runtime_error("shard"); }, 3), std::runtime_error);
+}
@@ -0,0 +1,122 @@
+#include <arba/strn/snapshot_map.hpp>
+#include <arba/strn/string64.hpp>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+using namespace strn::literals;
+
+// The views of a reader point to it.
+static_assert(!std::is_move_constructible_v<strn::snapshot_map<strn::string64, int>::reader>);
+
+TEST(snapshot_map_tests, test_empty)
+{
+    strn::snapshot_map<strn::string64, int> map;
+    ASSERT_EQ(map.max_readers(), 64);
+    auto reader = map.make_reader();
+    ASSERT_TRUE(reader.snapshot().empty());
+    ASSERT_FALSE(reader.find("AAPL"_s64).has_value());
+}
+
+TEST(snapshot_map_tests, test_insert_erase_assign)
+{
+    strn::snapshot_map<strn::string64, int> map;
+    auto reader = map.make_reader();
+    map.insert_or_assign("AAPL"_s64, 1);
+    map.insert_or_assign(""_s64, 2);
+    ASSERT_EQ(reader.find("AAPL"_s64), 1);
+    ASSERT_EQ(reader.find(""_s64), 2);
+    map.update([](auto& table) {
+        table.erase("AAPL"_s64);
+        table.insert_or_assign("MSFT"_s64, 3);
+    });
+    ASSERT_FALSE(reader.find("AAPL"_s64).has_value());
+    ASSERT_EQ(reader.find("MSFT"_s64), 3);
+    map.erase("MSFT"_s64);
+    ASSERT_EQ(reader.snapshot().size(), 1);
+
+    strn::flat_hash_map<strn::string64, int> table;
+    table.insert("IBM"_s64, 4);
+    map.assign(std::move(table));
+    const auto view = reader.snapshot();
+    ASSERT_EQ(view.size(), 1);
+    ASSERT_EQ(*view.find("IBM"_s64), 4);
+}
+
+TEST(snapshot_map_tests, test_view_is_stable)
+{
+    strn::snapshot_map<strn::string64, int> map;
+    auto reader = map.make_reader();
+    map.insert_or_assign("AAPL"_s64, 1);
+    {
+        const auto view = reader.snapshot();
+        map.insert_or_assign("AAPL"_s64, 2);
+        map.insert_or_assign("MSFT"_s64, 3);
+        // The pinned table is kept alive and unchanged.
+        ASSERT_EQ(*view.find("AAPL"_s64), 1);
+        ASSERT_FALSE(view.contains("MSFT"_s64));
+        // A nested view sees the same table.
+        ASSERT_EQ(reader.find("AAPL"_s64), 1);
+        ASSERT_GT(map.retired_count(), 0);
+    }
+    ASSERT_EQ(reader.find("AAPL"_s64), 2);
+    map.insert_or_assign("IBM"_s64, 4);
+    ASSERT_EQ(map.retired_count(), 0);
+}
+
+TEST(snapshot_map_tests, test_reader_slots)
+{
+    strn::snapshot_map<strn::string64, int> map(2);
+    auto first = map.make_reader();
+    {
+        auto second = map.make_reader();
+        ASSERT_THROW(map.make_reader(), std::runtime_error);
+    }
+    ASSERT_NO_THROW(map.make_reader());
+}
+
+TEST(snapshot_map_tests, test_concurrent_readers)
+{
+    strn::snapshot_map<strn::string64, uint64_t> map;
+    // Each table maps A and B to the same version: a reader never sees a half-updated table.
+    map.update([](auto& table) {
+        table.insert_or_assign("A"_s64, 0);
+        table.insert_or_assign("B"_s64, 0);
+    });
+    std::atomic<bool> done = false;
+    std::atomic<std::size_t> mismatches = 0;
+    std::vector<std::thread> readers;
+    for (int t = 0; t < 4; ++t)
+    {
+        readers.emplace_back([&] {
+            auto reader = map.make_reader();
+            uint64_t last = 0;
+            while (!done.load())
+            {
+                const auto view = reader.snapshot();
+                const uint64_t a = *view.find("A"_s64), b = *view.find("B"_s64);
+                mismatches += a != b || a < last;
+                last = a;
+            }
+        });
+    }
+    for (uint64_t version = 1; version <= 2'000; ++version)
+    {
+        map.update([version](auto& table) {
+            table.insert_or_assign("A"_s64, version);
+            table.insert_or_assign("B"_s64, version);
+        });
+    }
+    done = true;
+    for (std::thread& thread : readers)
+        thread.join();
+    ASSERT_EQ(mismatches, 0);
+    auto reader = map.make_reader();
+    ASSERT_EQ(reader.find("A"_s64), 2'000);
+}
@@ -0,0 +1,89 @@
+#include <arba/strn/static_map.hpp>
+#include <arba/strn/string32.hpp>
+#include <arba/strn/string56.hpp>
+#include <arba/strn/string64.hpp>
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <utility>
+
+using namespace strn::literals;
+
+namespace
+{
+constexpr auto message_types = strn::make_static_map([] {
+    return std::array{ std::pair{ "NEW"_s64, 1 },       std::pair{ "CANCEL"_s64, 2 }, std::pair{ "REPLACE"_s64, 3 },
+                       std::pair{ "EXECUTED"_s64, 4 },  std::pair{ "REJECT"_s64, 5 }, std::pair{ "STATUS"_s64, 6 },
+                       std::pair{ "HEARTBEA"_s64, 7 },  std::pair{ "LOGON"_s64, 8 },  std::pair{ "LOGOUT"_s64, 9 },
+                       std::pair{ "A"_s64, 10 } };
+});
+} // namespace
+
+static_assert(message_types.size() == 10);
+static_assert(*message_types.find("REPLACE"_s64) == 3);
+static_assert(message_types.find("REPLAC"_s64) == nullptr);
+static_assert(!message_types.contains(""_s64));
+
+TEST(static_map_tests, test_find)
+{
+    ASSERT_EQ(message_types.size(), 10);
+    ASSERT_GE(message_types.capacity(), 16);
+    ASSERT_EQ(message_types.seed() % 2, 1);
+    ASSERT_EQ(*message_types.find("NEW"_s64), 1);
+    ASSERT_EQ(*message_types.find("A"_s64), 10);
+    ASSERT_EQ(message_types.value_or("LOGOUT"_s64, 0), 9);
+    ASSERT_EQ(message_types.value_or("B"_s64, 0), 0);
+    ASSERT_FALSE(message_types.contains(""_s64));
+    ASSERT_FALSE(message_types.contains("new"_s64));
+    ASSERT_FALSE(message_types.contains("NEW "_s64));
+}
+
+TEST(static_map_tests, test_empty_key)
+{
+    constexpr auto map = strn::make_static_map([] {
+        return std::array{ std::pair{ ""_s32, 'e' }, std::pair{ "USD"_s32, 'u' }, std::pair{ "EUR"_s32, 'r' } };
+    });
+    ASSERT_EQ(*map.find(""_s32), 'e');
+    ASSERT_EQ(*map.find("USD"_s32), 'u');
+    ASSERT_EQ(*map.find("EUR"_s32), 'r');
+    ASSERT_FALSE(map.contains("JPY"_s32));
+}
+
+TEST(static_map_tests, test_string56)
+{
+    constexpr auto map = strn::make_static_map([] {
+        return std::array{ std::pair{ "AB"_s56, 1u }, std::pair{ "ABC"_s56, 2u }, std::pair{ "ABCDEFG"_s56, 3u } };
+    });
+    ASSERT_EQ(*map.find("AB"_s56), 1u);
+    ASSERT_EQ(*map.find("ABC"_s56), 2u);
+    ASSERT_EQ(*map.find("ABCDEFG"_s56), 3u);
+    ASSERT_FALSE(map.contains("ABCD"_s56));
+}
+
+TEST(static_map_tests, test_many_keys)
+{
+    // 256 keys: "K000" to "K255".
+    constexpr auto map = strn::make_static_map([] {
+        std::array<std::pair<strn::string64, int>, 256> pairs;
+        for (int i = 0; i < 256; ++i)
+        {
+            const char name[5] = { 'K', char('0' + i / 100), char('0' + i / 10 % 10), char('0' + i % 10), '\0' };
+            pairs[i] = { strn::literals::operator""_s64(name, 4), i };
+        }
+        return pairs;
+    });
+    static_assert(map.size() == 256);
+    // The table is dense: the power of two above 1.25 * size, with one pilot per 4 keys.
+    static_assert(map.capacity() == 512);
+    static_assert(map.bucket_count() == 64);
+    for (int i = 0; i < 256; ++i)
+    {
+        const char name[5] = { 'K', char('0' + i / 100), char('0' + i / 10 % 10), char('0' + i % 10), '\0' };
+        const strn::string64 key(std::string_view(name, 4));
+        ASSERT_NE(map.find(key), nullptr) << i;
+        ASSERT_EQ(*map.find(key), i);
+    }
+    ASSERT_FALSE(map.contains("K256"_s64));
+    ASSERT_FALSE(map.contains("K"_s64));
+}
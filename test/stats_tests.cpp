@@ -0,0 +1,83 @@
+#include <arba/strn/flat_hash_map.hpp>
+#include <arba/strn/from_views.hpp>
+#include <arba/strn/stats.hpp>
+#include <arba/strn/string32.hpp>
+#include <arba/strn/string56.hpp>
+#include <arba/strn/string64.hpp>
+
+#include <gtest/gtest.h>
+
+#include <numeric>
+#include <string>
+#include <string_view>
+
+using namespace strn::literals;
+
+TEST(stats_tests, test_constructions)
+{
+    strn::stats::reset();
+    [[maybe_unused]] const strn::string64 s64(std::string_view("ABCDEFGHIJ"));
+    [[maybe_unused]] const strn::string64 s64b(std::string("ABC"));
+    [[maybe_unused]] const strn::string56 s56(std::string_view("ABCDEFGH"));
+    [[maybe_unused]] const strn::string32 s32(std::string_view(""));
+    bool truncated = false;
+    [[maybe_unused]] const strn::string32 s32b = strn::from_view<strn::string32>(
+        std::string(40, 'x'), strn::truncation_policy::truncate, truncated);
+    // Literals and constant expressions are not counted.
+    [[maybe_unused]] constexpr strn::string64 literal = "ABCDEFGH"_s64;
+
+    const strn::stats::counters counters = strn::stats::snapshot();
+    if constexpr (!strn::stats::enabled)
+    {
+        ASSERT_EQ(counters.string64.constructed, 0);
+        GTEST_SKIP() << "instrumentation disabled";
+    }
+    ASSERT_EQ(counters.string64.constructed, 2);
+    ASSERT_EQ(counters.string64.truncated, 1);
+    ASSERT_EQ(counters.string64.length_histogram[10], 1);
+    ASSERT_EQ(counters.string64.length_histogram[3], 1);
+    ASSERT_EQ(counters.string56.constructed, 1);
+    ASSERT_EQ(counters.string56.truncated, 1);
+    ASSERT_EQ(counters.string32.constructed, 2);
+    ASSERT_EQ(counters.string32.truncated, 1);
+    ASSERT_EQ(counters.string32.length_histogram[0], 1);
+    ASSERT_EQ(counters.string32.length_histogram.back(), 1);
+}
+
+TEST(stats_tests, test_bad_literals)
+{
+    strn::stats::reset();
+    const char* text = "ABCDEFGHI";
+    const std::size_t length = std::char_traits<char>::length(text);
+    ASSERT_EQ(strn::literals::operator""_s64(text, length), "#BAD_S64"_s64);
+    ASSERT_EQ(strn::literals::operator""_s32(text, length), "#BAD"_s32);
+
+    const strn::stats::counters counters = strn::stats::snapshot();
+    if constexpr (!strn::stats::enabled)
+        GTEST_SKIP() << "instrumentation disabled";
+    ASSERT_EQ(counters.string64.bad_literals, 1);
+    ASSERT_EQ(counters.string32.bad_literals, 1);
+    ASSERT_EQ(counters.string56.bad_literals, 0);
+}
+
+TEST(stats_tests, test_probes)
+{
+    strn::flat_hash_map<strn::string64, int> map;
+    map["AAPL"_s64] = 1;
+    map["MSFT"_s64] = 2;
+    strn::stats::reset();
+    ASSERT_TRUE(map.contains("AAPL"_s64));
+    ASSERT_TRUE(map.contains("MSFT"_s64));
+    ASSERT_FALSE(map.contains("IBM"_s64));
+    ASSERT_FALSE(map.contains(""_s64));
+
+    const strn::stats::counters counters = strn::stats::snapshot();
+    if constexpr (!strn::stats::enabled)
+        GTEST_SKIP() << "instrumentation disabled";
+    // The empty key is stored aside: no probe.
+    ASSERT_EQ(counters.flat_hash_map.lookups, 3);
+    ASSERT_GE(counters.flat_hash_map.probes, 3);
+    const auto& histogram = counters.flat_hash_map.probe_histogram;
+    ASSERT_EQ(std::accumulate(histogram.begin(), histogram.end(), uint64_t(0)), 3);
+    ASSERT_EQ(counters.mapped_table.lookups, 0);
+}
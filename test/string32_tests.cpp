@@ -376,6 +376,96 @@ TEST(string32_tests, test_resize_too_much)
     ASSERT_EQ(str.length(), str.max_length());
 }
 
+TEST(string32_tests, test_push_back_full)
+{
+    strn::string32 str("ABCD");
+    str.push_back('Z');
+    ASSERT_EQ(str, strn::string32("ABCD"));
+    ASSERT_EQ(str.length(), str.max_length());
+}
+
+TEST(string32_tests, test_pop_back_empty)
+{
+    strn::string32 str;
+    str.pop_back();
+    ASSERT_TRUE(str.empty());
+    ASSERT_EQ(str.length(), 0);
+}
+
+TEST(string32_tests, test_length_every_length)
+{
+    const std::string_view chars = "ABCD";
+    for (std::size_t length = 0; length <= strn::string32::max_length(); ++length)
+    {
+        strn::string32 str(chars.substr(0, length));
+        ASSERT_EQ(str.length(), length);
+        ASSERT_EQ(str.to_string_view(), chars.substr(0, length));
+    }
+}
+
+TEST(string32_tests, test_push_back_pop_back_every_length)
+{
+    const std::string_view chars = "ABCD";
+    strn::string32 str;
+    for (std::size_t length = 1; length <= strn::string32::max_length(); ++length)
+    {
+        str.push_back(chars[length - 1]);
+        ASSERT_EQ(str, strn::string32(chars.substr(0, length)));
+    }
+    for (std::size_t length = strn::string32::max_length(); length-- > 0;)
+    {
+        str.pop_back();
+        ASSERT_EQ(str, strn::string32(chars.substr(0, length)));
+    }
+}
+
+TEST(string32_tests, test_resize_from_empty)
+{
+    strn::string32 str;
+    str.resize(2, 'c');
+    ASSERT_EQ(str, strn::string32("cc"));
+    str.resize(0, 'c');
+    ASSERT_TRUE(str.empty());
+}
+
+TEST(string32_tests, test_clear_from)
+{
+    strn::string32 str("ABCD");
+    str.clear_from(9);
+    ASSERT_EQ(str, strn::string32("ABCD"));
+    str.clear_from(2);
+    ASSERT_EQ(str, strn::string32("AB"));
+    ASSERT_EQ(str.length(), 2);
+    str.clear_from(3);
+    ASSERT_EQ(str, strn::string32("AB"));
+    str.clear_from(0);
+    ASSERT_TRUE(str.empty());
+}
+
+TEST(string32_tests, test_append)
+{
+    strn::string32 str("AB");
+    ASSERT_TRUE(str.append("C"_s32));
+    ASSERT_EQ(str, "ABC"_s32);
+    ASSERT_TRUE(str.append(""_s32));
+    ASSERT_EQ(str.length(), 3);
+    ASSERT_EQ(strn::string32() + "AB"_s32, "AB"_s32);
+    ASSERT_EQ("AB"_s32 + ""_s32, "AB"_s32);
+}
+
+TEST(string32_tests, test_append_overflow)
+{
+    strn::string32 str("A");
+    ASSERT_FALSE(str.append("ABCD"_s32, strn::overflow_policy::saturate));
+    ASSERT_EQ(str, "A"_s32);
+    ASSERT_FALSE(str.append("ABCD"_s32));
+    ASSERT_EQ(str, "AABC"_s32);
+    ASSERT_EQ(str.length(), str.max_length());
+    ASSERT_FALSE(str.append("Z"_s32));
+    ASSERT_EQ(str, "AABC"_s32);
+    ASSERT_EQ("ABCD"_s32 + "ABCD"_s32, "ABCD"_s32);
+}
+
 enum number : uint32_t
 {
     ONE = "ONE"_s32.integer(),
@@ -486,6 +576,16 @@ TEST(string32_tests, test_operator_format)
     ASSERT_EQ(std::format("{}", str_b), "B123");
 }
 
+TEST(string32_tests, test_operator_format_specs)
+{
+    strn::string32 str("Ab\n");
+    ASSERT_EQ(std::format("{:x}", str), std::format("{:x}", str.integer()));
+    ASSERT_EQ(std::format("{:q}", str), "\"Ab\\n\"");
+    ASSERT_EQ(std::format("{:U}", str), "AB\n");
+    ASSERT_EQ(std::format("{:L}", str), "ab\n");
+    ASSERT_EQ(std::format("{:>5}", "EUR"_s32), "  EUR");
+}
+
 TEST(string32_tests, test_constexpr)
 {
     if constexpr ("a"_s32 == "a"_s32)
@@ -507,3 +607,26 @@ TEST(string32_tests, test_constexpr_fail)
 }
 
 constexpr strn::string32 constexpr_str = "cexp";
+
+constexpr strn::string32 constexpr_built()
+{
+    strn::string32 str(std::string_view("AB"));
+    str.push_back('C');
+    str.push_back('D');
+    str.pop_back();
+    str[0] = 'X';
+    str.resize(2);
+    return str;
+}
+
+static_assert(constexpr_built() == "XB"_s32);
+static_assert([] {
+    strn::string32 str("ABC");
+    str.clear_from(1);
+    str.resize(3, 'z');
+    return str;
+}() == "Azz"_s32);
+static_assert(constexpr_built().to_string_view() == "XB");
+static_assert(strn::string32(std::string_view("ABCDEF")).length() == 4);
+static_assert(*strn::string32("ABC").begin() == 'A');
+static_assert(strn::string32("ABC").integer() == "ABC"_s32.integer());
@@ -387,6 +387,96 @@ TEST(string56_tests, test_resize_too_much)
     ASSERT_EQ(str.length(), str.max_length());
 }
 
+TEST(string56_tests, test_push_back_full)
+{
+    strn::string56 str("ABCDEFG");
+    str.push_back('Z');
+    ASSERT_EQ(str, strn::string56("ABCDEFG"));
+    ASSERT_EQ(str.length(), str.max_length());
+}
+
+TEST(string56_tests, test_pop_back_empty)
+{
+    strn::string56 str;
+    str.pop_back();
+    ASSERT_TRUE(str.empty());
+    ASSERT_EQ(str.length(), 0);
+}
+
+TEST(string56_tests, test_length_every_length)
+{
+    const std::string_view chars = "ABCDEFG";
+    for (std::size_t length = 0; length <= strn::string56::max_length(); ++length)
+    {
+        strn::string56 str(chars.substr(0, length));
+        ASSERT_EQ(str.length(), length);
+        ASSERT_EQ(str.to_string_view(), chars.substr(0, length));
+    }
+}
+
+TEST(string56_tests, test_push_back_pop_back_every_length)
+{
+    const std::string_view chars = "ABCDEFG";
+    strn::string56 str;
+    for (std::size_t length = 1; length <= strn::string56::max_length(); ++length)
+    {
+        str.push_back(chars[length - 1]);
+        ASSERT_EQ(str, strn::string56(chars.substr(0, length)));
+    }
+    for (std::size_t length = strn::string56::max_length(); length-- > 0;)
+    {
+        str.pop_back();
+        ASSERT_EQ(str, strn::string56(chars.substr(0, length)));
+    }
+}
+
+TEST(string56_tests, test_resize_from_empty)
+{
+    strn::string56 str;
+    str.resize(2, 'c');
+    ASSERT_EQ(str, strn::string56("cc"));
+    str.resize(0, 'c');
+    ASSERT_TRUE(str.empty());
+}
+
+TEST(string56_tests, test_clear_from)
+{
+    strn::string56 str("ABCDEFG");
+    str.clear_from(9);
+    ASSERT_EQ(str, strn::string56("ABCDEFG"));
+    str.clear_from(2);
+    ASSERT_EQ(str, strn::string56("AB"));
+    ASSERT_EQ(str.length(), 2);
+    str.clear_from(3);
+    ASSERT_EQ(str, strn::string56("AB"));
+    str.clear_from(0);
+    ASSERT_TRUE(str.empty());
+}
+
+TEST(string56_tests, test_append)
+{
+    strn::string56 str("AB");
+    ASSERT_TRUE(str.append("C"_s56));
+    ASSERT_EQ(str, "ABC"_s56);
+    ASSERT_TRUE(str.append(""_s56));
+    ASSERT_EQ(str.length(), 3);
+    ASSERT_EQ(strn::string56() + "AB"_s56, "AB"_s56);
+    ASSERT_EQ("AB"_s56 + ""_s56, "AB"_s56);
+}
+
+TEST(string56_tests, test_append_overflow)
+{
+    strn::string56 str("A");
+    ASSERT_FALSE(str.append("ABCDEFG"_s56, strn::overflow_policy::saturate));
+    ASSERT_EQ(str, "A"_s56);
+    ASSERT_FALSE(str.append("ABCDEFG"_s56));
+    ASSERT_EQ(str, "AABCDEF"_s56);
+    ASSERT_EQ(str.length(), str.max_length());
+    ASSERT_FALSE(str.append("Z"_s56));
+    ASSERT_EQ(str, "AABCDEF"_s56);
+    ASSERT_EQ("ABCDEFG"_s56 + "ABCDEFG"_s56, "ABCDEFG"_s56);
+}
+
 enum number : uint64_t
 {
     ONE = "ONE"_s56.integer(),
@@ -497,6 +587,16 @@ TEST(string56_tests, test_operator_format)
     ASSERT_EQ(std::format("{}", str_b), "B123456");
 }
 
+TEST(string56_tests, test_operator_format_specs)
+{
+    strn::string56 str("Ab\"c");
+    ASSERT_EQ(std::format("{:x}", str), std::format("{:x}", str.integer()));
+    ASSERT_EQ(std::format("{:q}", str), "\"Ab\\\"c\"");
+    ASSERT_EQ(std::format("{:U}", str), "AB\"C");
+    ASSERT_EQ(std::format("{:L}", str), "ab\"c");
+    ASSERT_EQ(std::format("{:>5}", "EUR"_s56), "  EUR");
+}
+
 TEST(string56_tests, test_constexpr)
 {
     if constexpr ("a"_s56 == "a"_s56)
@@ -518,3 +618,26 @@ TEST(string56_tests, test_constexpr_fail)
 }
 
 constexpr strn::string56 constexpr_str = "cstexpr";
+
+constexpr strn::string56 constexpr_built()
+{
+    strn::string56 str(std::string_view("AB"));
+    str.push_back('C');
+    str.push_back('D');
+    str.pop_back();
+    str[0] = 'X';
+    str.resize(2);
+    return str;
+}
+
+static_assert(constexpr_built() == "XB"_s56);
+static_assert([] {
+    strn::string56 str("ABC");
+    str.clear_from(1);
+    str.resize(3, 'z');
+    return str;
+}() == "Azz"_s56);
+static_assert(constexpr_built().to_string_view() == "XB");
+static_assert(strn::string56(std::string_view("ABCDEFGHIJ")).length() == 7);
+static_assert(*strn::string56("ABC").begin() == 'A');
+static_assert(strn::string56("ABC").integer() == "ABC"_s56.integer());
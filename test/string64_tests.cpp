@@ -389,6 +389,96 @@ TEST(string64_tests, test_resize_too_much)
     ASSERT_EQ(str.length(), str.max_length());
 }
 
+TEST(string64_tests, test_push_back_full)
+{
+    strn::string64 str("ABCDEFGH");
+    str.push_back('Z');
+    ASSERT_EQ(str, strn::string64("ABCDEFGH"));
+    ASSERT_EQ(str.length(), str.max_length());
+}
+
+TEST(string64_tests, test_pop_back_empty)
+{
+    strn::string64 str;
+    str.pop_back();
+    ASSERT_TRUE(str.empty());
+    ASSERT_EQ(str.length(), 0);
+}
+
+TEST(string64_tests, test_length_every_length)
+{
+    const std::string_view chars = "ABCDEFGH";
+    for (std::size_t length = 0; length <= strn::string64::max_length(); ++length)
+    {
+        strn::string64 str(chars.substr(0, length));
+        ASSERT_EQ(str.length(), length);
+        ASSERT_EQ(str.to_string_view(), chars.substr(0, length));
+    }
+}
+
+TEST(string64_tests, test_push_back_pop_back_every_length)
+{
+    const std::string_view chars = "ABCDEFGH";
+    strn::string64 str;
+    for (std::size_t length = 1; length <= strn::string64::max_length(); ++length)
+    {
+        str.push_back(chars[length - 1]);
+        ASSERT_EQ(str, strn::string64(chars.substr(0, length)));
+    }
+    for (std::size_t length = strn::string64::max_length(); length-- > 0;)
+    {
+        str.pop_back();
+        ASSERT_EQ(str, strn::string64(chars.substr(0, length)));
+    }
+}
+
+TEST(string64_tests, test_resize_from_empty)
+{
+    strn::string64 str;
+    str.resize(2, 'c');
+    ASSERT_EQ(str, strn::string64("cc"));
+    str.resize(0, 'c');
+    ASSERT_TRUE(str.empty());
+}
+
+TEST(string64_tests, test_clear_from)
+{
+    strn::string64 str("ABCDEFGH");
+    str.clear_from(9);
+    ASSERT_EQ(str, strn::string64("ABCDEFGH"));
+    str.clear_from(2);
+    ASSERT_EQ(str, strn::string64("AB"));
+    ASSERT_EQ(str.length(), 2);
+    str.clear_from(3);
+    ASSERT_EQ(str, strn::string64("AB"));
+    str.clear_from(0);
+    ASSERT_TRUE(str.empty());
+}
+
+TEST(string64_tests, test_append)
+{
+    strn::string64 str("AB");
+    ASSERT_TRUE(str.append("C"_s64));
+    ASSERT_EQ(str, "ABC"_s64);
+    ASSERT_TRUE(str.append(""_s64));
+    ASSERT_EQ(str.length(), 3);
+    ASSERT_EQ(strn::string64() + "AB"_s64, "AB"_s64);
+    ASSERT_EQ("AB"_s64 + ""_s64, "AB"_s64);
+}
+
+TEST(string64_tests, test_append_overflow)
+{
+    strn::string64 str("A");
+    ASSERT_FALSE(str.append("ABCDEFGH"_s64, strn::overflow_policy::saturate));
+    ASSERT_EQ(str, "A"_s64);
+    ASSERT_FALSE(str.append("ABCDEFGH"_s64));
+    ASSERT_EQ(str, "AABCDEFG"_s64);
+    ASSERT_EQ(str.length(), str.max_length());
+    ASSERT_FALSE(str.append("Z"_s64));
+    ASSERT_EQ(str, "AABCDEFG"_s64);
+    ASSERT_EQ("ABCDEFGH"_s64 + "ABCDEFGH"_s64, "ABCDEFGH"_s64);
+}
+
 enum number : uint64_t
 {
     ONE = "ONE"_s64.integer(),
@@ -499,6 +589,18 @@ TEST(string64_tests, test_operator_format)
     ASSERT_EQ(std::format("{}", str_b), "B1234567");
 }
 
+TEST(string64_tests, test_operator_format_specs)
+{
+    strn::string64 str("Ab\1z");
+    ASSERT_EQ(std::format("{:x}", str), std::format("{:x}", str.integer()));
+    ASSERT_EQ(std::format("{:x}", "A"_s64), "41");
+    ASSERT_EQ(std::format("{:q}", str), "\"Ab\\x01z\"");
+    ASSERT_EQ(std::format("{:U}", str), "AB\1Z");
+    ASSERT_EQ(std::format("{:L}", str), "ab\1z");
+    ASSERT_EQ(std::format("{:>10}", "AAPL"_s64), "      AAPL");
+    ASSERT_EQ(std::format("{}|{:q}", ""_s64, ""_s64), "|\"\"");
+}
+
 TEST(string64_tests, test_constexpr)
 {
     if constexpr ("a"_s64 == "a"_s64)
@@ -520,3 +622,34 @@ TEST(string64_tests, test_constexpr_fail)
 }
 
 constexpr strn::string64 constexpr_str = "cstexpr";
+
+constexpr strn::string64 constexpr_built()
+{
+    strn::string64 str(std::string_view("AB"));
+    str.push_back('C');
+    str.push_back('D');
+    str.pop_back();
+    str[0] = 'X';
+    str.resize(2);
+    return str;
+}
+
+static_assert(constexpr_built() == "XB"_s64);
+static_assert([] {
+    strn::string64 str("ABC");
+    str.clear_from(1);
+    str.resize(3, 'z');
+    return str;
+}() == "Azz"_s64);
+static_assert(constexpr_built().to_string_view() == "XB");
+static_assert(strn::string64(std::string_view("ABCDEFGHIJ")).length() == 8);
+static_assert(*strn::string64("ABC").begin() == 'A');
+static_assert(strn::string64("ABC").integer() == "ABC"_s64.integer());
+
+TEST(string64_tests, test_s64_literal_non_ascii)
+{
+    constexpr strn::string64 str = "\xe9t\xe9"_s64;
+    static_assert(str.length() == 3);
+    ASSERT_EQ(str, strn::string64(std::string_view("\xe9t\xe9")));
+    ASSERT_EQ(str.to_string_view(), "\xe9t\xe9");
+}
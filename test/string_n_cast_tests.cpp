@@ -0,0 +1,89 @@
+#include <arba/strn/string32.hpp>
+#include <arba/strn/string56.hpp>
+#include <arba/strn/string64.hpp>
+#include <arba/strn/string_n_cast.hpp>
+
+#include <gtest/gtest.h>
+
+#include <type_traits>
+
+using namespace strn::literals;
+
+static_assert(!std::is_convertible_v<strn::string32, strn::string64>);
+static_assert(std::is_constructible_v<strn::string64, strn::string32>);
+static_assert(strn::string_n_cast<strn::string64>("ABCD"_s32) == "ABCD"_s64);
+static_assert(strn::string_n_cast<strn::string56>("ABCDEFGH"_s64) == "ABCDEFG"_s56);
+static_assert(strn::string_n_cast<strn::string32>("ABC"_s56) == "ABC"_s32);
+static_assert(strn::string64("ABC"_s56).length() == 3);
+static_assert("ABC"_s32 == "ABC"_s64);
+static_assert("ABC"_s56 != "ABCD"_s64);
+
+TEST(string_n_cast_tests, test_widening)
+{
+    for (const strn::string32 str : { ""_s32, "A"_s32, "AB"_s32, "ABC"_s32, "ABCD"_s32 })
+    {
+        bool truncated = true;
+        const strn::string64 str64
+            = strn::string_n_cast<strn::string64>(str, strn::truncation_policy::truncate, truncated);
+        ASSERT_FALSE(truncated);
+        ASSERT_EQ(str64.to_string_view(), str.to_string_view());
+        const strn::string56 str56(str);
+        ASSERT_EQ(str56.to_string_view(), str.to_string_view());
+        ASSERT_EQ(str56.length(), str.length());
+        ASSERT_EQ(str56, strn::string56(str.to_string_view()));
+    }
+    const strn::string64 str64("ABCDEFG"_s56);
+    ASSERT_EQ(str64, "ABCDEFG"_s64);
+    ASSERT_EQ(str64.length(), 7);
+}
+
+TEST(string_n_cast_tests, test_narrowing)
+{
+    bool truncated = false;
+    const strn::string56 str56
+        = strn::string_n_cast<strn::string56>("ABCDEFGH"_s64, strn::truncation_policy::truncate, truncated);
+    ASSERT_TRUE(truncated);
+    ASSERT_EQ(str56, "ABCDEFG"_s56);
+    ASSERT_EQ(str56.length(), 7);
+
+    const strn::string32 str32
+        = strn::string_n_cast<strn::string32>("ABCDEF"_s56, strn::truncation_policy::truncate, truncated);
+    ASSERT_TRUE(truncated);
+    ASSERT_EQ(str32, "ABCD"_s32);
+
+    ASSERT_EQ(strn::string_n_cast<strn::string32>("ABC"_s64, strn::truncation_policy::truncate, truncated), "ABC"_s32);
+    ASSERT_FALSE(truncated);
+    ASSERT_EQ(strn::string_n_cast<strn::string56>("ABCDEFG"_s64, strn::truncation_policy::truncate, truncated),
+              "ABCDEFG"_s56);
+    ASSERT_FALSE(truncated);
+}
+
+TEST(string_n_cast_tests, test_narrowing_clear)
+{
+    bool truncated = false;
+    ASSERT_TRUE(strn::string_n_cast<strn::string32>("ABCDE"_s64, strn::truncation_policy::clear, truncated).empty());
+    ASSERT_TRUE(truncated);
+    ASSERT_EQ(strn::string_n_cast<strn::string32>("ABCD"_s64, strn::truncation_policy::clear, truncated), "ABCD"_s32);
+    ASSERT_FALSE(truncated);
+}
+
+TEST(string_n_cast_tests, test_constructors)
+{
+    ASSERT_EQ(strn::string32("ABCDEFGH"_s64), "ABCD"_s32);
+    ASSERT_EQ(strn::string56("ABCDEFGH"_s64), "ABCDEFG"_s56);
+    ASSERT_EQ(strn::string56("ABCDEFGH"_s64).length(), 7);
+    ASSERT_EQ(strn::string64("AB"_s32), "AB"_s64);
+    ASSERT_EQ(strn::string32(""_s56), ""_s32);
+}
+
+TEST(string_n_cast_tests, test_cross_type_equality)
+{
+    ASSERT_TRUE("ABCD"_s32 == "ABCD"_s64);
+    ASSERT_TRUE("ABCD"_s64 == "ABCD"_s32);
+    ASSERT_TRUE("ABCD"_s56 == "ABCD"_s32);
+    ASSERT_TRUE(""_s56 == ""_s64);
+    ASSERT_FALSE("ABCD"_s32 == "ABCDE"_s64);
+    ASSERT_FALSE("ABCDEFG"_s56 == "ABCDEFGH"_s64);
+    ASSERT_TRUE("ABCDEFG"_s56 == "ABCDEFG"_s64);
+    ASSERT_TRUE("ABC"_s56 != "ABD"_s32);
+}
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <arba/strn/string64.hpp>
+
+#include <cstdint>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace test_keys
+{
+/**
+ * @brief count distinct keys: prefix followed by 0, 1, ..., count - 1.
+ */
+inline std::vector<strn::string64> make_keys(std::size_t count, std::string_view prefix)
+{
+    std::vector<strn::string64> keys;
+    keys.reserve(count);
+    for (std::size_t i = 0; i < count; ++i)
+        keys.emplace_back(std::string(prefix) + std::to_string(i));
+    return keys;
+}
+
+/**
+ * @brief count keys drawn among distinct keys "S0", "S1", ... with a Zipf distribution: "Si" has weight 1 / (i + 1).
+ */
+inline std::vector<strn::string64> zipf_keys(std::size_t count, std::size_t distinct, uint64_t seed)
+{
+    std::mt19937_64 engine(seed);
+    std::vector<double> weights(distinct);
+    for (std::size_t i = 0; i < distinct; ++i)
+        weights[i] = 1.0 / double(i + 1);
+    std::discrete_distribution<std::size_t> distribution(weights.begin(), weights.end());
+    std::vector<strn::string64> keys(count);
+    for (strn::string64& key : keys)
+        key = strn::string64("S" + std::to_string(distribution(engine)));
+    return keys;
+}
+} // namespace test_keys
@@ -0,0 +1,109 @@
+#include <arba/strn/string32.hpp>
+#include <arba/strn/string64.hpp>
+#include <arba/strn/token_reader.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace strn::literals;
+
+namespace
+{
+class token_reader_tests : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        const std::string name = ::testing::UnitTest::GetInstance()->current_test_info()->name();
+        path_ = std::filesystem::temp_directory_path() / ("strn_token_reader_tests_" + name + ".txt");
+    }
+
+    void TearDown() override { std::filesystem::remove(path_); }
+
+    void write_file(const std::string& contents) { std::ofstream(path_, std::ios::binary) << contents; }
+
+    template <class StringN>
+    std::vector<StringN> read_all(const strn::token_reader_options& options = strn::token_reader_options())
+    {
+        strn::token_reader<StringN> reader(path_, options);
+        std::vector<StringN> tokens;
+        for (const StringN& token : reader)
+            tokens.push_back(token);
+        return tokens;
+    }
+
+    std::filesystem::path path_;
+};
+} // namespace
+
+TEST_F(token_reader_tests, test_empty_file)
+{
+    write_file("");
+    ASSERT_TRUE(read_all<strn::string64>().empty());
+    write_file(" \n\t  \r\n");
+    ASSERT_TRUE(read_all<strn::string64>().empty());
+}
+
+TEST_F(token_reader_tests, test_tokens)
+{
+    write_file("  AAPL MSFT\tGOOG\n\nIBM123456789 X");
+    strn::token_reader<strn::string64> reader(path_);
+    std::vector<strn::string64> tokens;
+    strn::string64 token;
+    while (reader.next(token))
+        tokens.push_back(token);
+    ASSERT_EQ(tokens, (std::vector<strn::string64>{ "AAPL"_s64, "MSFT"_s64, "GOOG"_s64, "IBM12345"_s64, "X"_s64 }));
+    ASSERT_EQ(reader.truncated_count(), 1);
+    ASSERT_FALSE(reader.next(token));
+}
+
+TEST_F(token_reader_tests, test_tokens_straddling_blocks)
+{
+    std::mt19937 engine(3);
+    std::uniform_int_distribution<int> length_dist(1, 12), char_dist('a', 'z'), space_dist(1, 3);
+    std::string contents;
+    while (contents.size() < 50'000)
+    {
+        contents.append(length_dist(engine), static_cast<char>(char_dist(engine)));
+        contents.append(space_dist(engine), ' ');
+    }
+    contents.append("lastword");
+    write_file(contents);
+
+    std::vector<strn::string32> expected;
+    std::istringstream stream(contents);
+    for (std::string word; stream >> word;)
+        expected.emplace_back(word);
+
+    strn::token_reader_options options;
+    options.block_size = 4096;
+    ASSERT_EQ(read_all<strn::string32>(options), expected);
+    options.direct_io = true;
+    ASSERT_EQ(read_all<strn::string32>(options), expected);
+}
+
+TEST_F(token_reader_tests, test_file_descriptor)
+{
+    std::FILE* file = std::tmpfile();
+    ASSERT_NE(file, nullptr);
+    std::fputs("one two three", file);
+    std::fflush(file);
+    std::rewind(file);
+    strn::token_reader<strn::string64> reader(fileno(file));
+    std::vector<strn::string64> tokens(reader.begin(), reader.end());
+    ASSERT_EQ(tokens, (std::vector<strn::string64>{ "one"_s64, "two"_s64, "three"_s64 }));
+    std::fclose(file);
+}
+
+TEST_F(token_reader_tests, test_missing_file)
+{
+    using reader_type = strn::token_reader<strn::string64>;
+    ASSERT_THROW(reader_type reader(path_), std::system_error);
+}
@@ -0,0 +1,104 @@
+#include <arba/strn/string32.hpp>
+#include <arba/strn/string64.hpp>
+#include <arba/strn/top_k.hpp>
+
+#include <gtest/gtest.h>
+
+#include "test_keys.hpp"
+
+#include <algorithm>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace strn::literals;
+using test_keys::zipf_keys;
+
+namespace
+{
+template <class Entries>
+void check_counts(const Entries& entries, const std::map<strn::string64, uint64_t>& expected, std::size_t total,
+                  std::size_t capacity)
+{
+    ASSERT_EQ(entries.size(), capacity);
+    ASSERT_TRUE(std::is_sorted(entries.begin(), entries.end(),
+                               [](const auto& lhs, const auto& rhs) { return lhs.count > rhs.count; }));
+    for (const auto& [key, count, error] : entries)
+    {
+        const uint64_t true_count = expected.contains(key) ? expected.at(key) : 0;
+        ASSERT_GE(count, true_count) << key.to_string();
+        ASSERT_LE(count - error, true_count) << key.to_string();
+    }
+    // Every key occurring more than total / capacity times is monitored.
+    for (const auto& [key, count] : expected)
+    {
+        if (count > total / capacity)
+        {
+            ASSERT_TRUE(std::any_of(entries.begin(), entries.end(), [&](const auto& item) { return item.key == key; }))
+                << key.to_string();
+        }
+    }
+}
+} // namespace
+
+TEST(top_k_tests, test_constructor)
+{
+    ASSERT_THROW(strn::top_k<strn::string64>(0), std::invalid_argument);
+    strn::top_k<strn::string64> summary(10);
+    ASSERT_EQ(summary.capacity(), 10);
+    ASSERT_TRUE(summary.empty());
+    ASSERT_TRUE(summary.entries().empty());
+}
+
+TEST(top_k_tests, test_exact_below_capacity)
+{
+    strn::top_k<strn::string32> summary(4);
+    summary.add("AAPL"_s32, 5);
+    summary.add("MSFT"_s32);
+    summary.add(""_s32, 3);
+    summary.add("MSFT"_s32);
+    const auto entries = summary.entries();
+    ASSERT_EQ(entries.size(), 3);
+    ASSERT_EQ(entries[0].key, "AAPL"_s32);
+    ASSERT_EQ(entries[0].count, 5);
+    ASSERT_EQ(entries[1].key, ""_s32);
+    ASSERT_EQ(entries[1].count, 3);
+    ASSERT_EQ(entries[2].key, "MSFT"_s32);
+    ASSERT_EQ(entries[2].count, 2);
+    ASSERT_EQ(entries[2].error, 0);
+    summary.clear();
+    ASSERT_TRUE(summary.empty());
+}
+
+TEST(top_k_tests, test_heavy_hitters)
+{
+    const std::vector<strn::string64> keys = zipf_keys(300'000, 10'000, 7);
+    std::map<strn::string64, uint64_t> expected;
+    for (const strn::string64& key : keys)
+        ++expected[key];
+    strn::top_k<strn::string64> summary(100);
+    summary.add(keys);
+    const auto entries = summary.entries();
+    check_counts(entries, expected, keys.size(), summary.capacity());
+    ASSERT_EQ(entries[0].key, "S0"_s64);
+}
+
+TEST(top_k_tests, test_merge)
+{
+    const std::vector<strn::string64> first_keys = zipf_keys(200'000, 10'000, 11);
+    const std::vector<strn::string64> second_keys = zipf_keys(100'000, 10'000, 13);
+    std::map<strn::string64, uint64_t> expected;
+    for (const strn::string64& key : first_keys)
+        ++expected[key];
+    for (const strn::string64& key : second_keys)
+        ++expected[key];
+    strn::top_k<strn::string64> first(100), second(100);
+    first.add(first_keys);
+    second.add(second_keys);
+    first.merge(second);
+    check_counts(first.entries(), expected, first_keys.size() + second_keys.size(), first.capacity());
+    // The merged summary keeps working.
+    first.add("NEW"_s64, 1'000'000);
+    ASSERT_EQ(first.entries()[0].key, "NEW"_s64);
+}
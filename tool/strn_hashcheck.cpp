@@ -0,0 +1,219 @@
+#include <arba/strn/flat_hash_map.hpp>
+#include <arba/strn/hash_policy.hpp>
+#include <arba/strn/string32.hpp>
+#include <arba/strn/string56.hpp>
+#include <arba/strn/string64.hpp>
+#include <arba/strn/token_reader.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <exception>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+// Report how the hash policies spread the keys of a file, and time std::unordered_map and strn::flat_hash_map with
+// each of them.
+
+namespace
+{
+
+constexpr double max_timed_mean_probe_length = 64;
+
+struct distribution
+{
+    std::size_t table_size = 0;
+    std::size_t occupied = 0;
+    std::size_t max_bucket_size = 0;
+    std::size_t max_probe_length = 0;
+    double mean_probe_length = 0;
+};
+
+std::size_t next_prime(std::size_t value)
+{
+    const auto is_prime = [](std::size_t number) {
+        if (number < 2)
+            return false;
+        for (std::size_t divisor = 2; divisor * divisor <= number; ++divisor)
+            if (number % divisor == 0)
+                return false;
+        return true;
+    };
+    while (!is_prime(value))
+        ++value;
+    return value;
+}
+
+// Chained bucket sizes, and probe lengths of a linear probing table filled in key order.
+template <class IndexFunction>
+distribution analyze(const std::vector<std::size_t>& hashes, std::size_t table_size, IndexFunction&& index_of)
+{
+    distribution result;
+    result.table_size = table_size;
+    std::vector<std::size_t> bucket_sizes(table_size, 0);
+    // next_free[slot] leads to the first free slot from slot on (union-find with path halving), so that even a
+    // degenerate hash is analyzed in about linear time.
+    std::vector<std::size_t> next_free(table_size);
+    for (std::size_t slot = 0; slot < table_size; ++slot)
+        next_free[slot] = slot;
+    const auto find_free = [&](std::size_t slot) {
+        while (next_free[slot] != slot)
+        {
+            next_free[slot] = next_free[next_free[slot]];
+            slot = next_free[slot];
+        }
+        return slot;
+    };
+    std::size_t total_probe_length = 0;
+    for (std::size_t hash : hashes)
+    {
+        const std::size_t index = index_of(hash);
+        if (bucket_sizes[index]++ == 0)
+            ++result.occupied;
+        result.max_bucket_size = std::max(result.max_bucket_size, bucket_sizes[index]);
+        const std::size_t slot = find_free(index);
+        next_free[slot] = find_free((slot + 1) % table_size);
+        const std::size_t probe_length = (slot + table_size - index) % table_size + 1;
+        result.max_probe_length = std::max(result.max_probe_length, probe_length);
+        total_probe_length += probe_length;
+    }
+    result.mean_probe_length = hashes.empty() ? 0. : double(total_probe_length) / double(hashes.size());
+    return result;
+}
+
+void print_distribution(std::string_view table_kind, const distribution& result, std::size_t key_count)
+{
+    // The expected number of occupied buckets if the hash values were random.
+    const double size = double(result.table_size);
+    const double expected_occupied = size * (1. - std::pow(1. - 1. / size, double(key_count)));
+    const double collision_rate = key_count == 0 ? 0. : double(key_count - result.occupied) / double(key_count);
+    std::cout << "    " << std::left << std::setw(22) << table_kind << std::right << std::setw(10) << result.table_size
+              << std::setw(10) << result.occupied << std::setw(9) << std::fixed << std::setprecision(3)
+              << double(result.occupied) / expected_occupied << std::setw(11) << std::setprecision(2)
+              << 100. * collision_rate << "%" << std::setw(8) << result.max_bucket_size << std::setw(10)
+              << result.max_probe_length << std::setw(10) << result.mean_probe_length << std::endl;
+}
+
+template <class Function>
+double time_per_key_ns(std::size_t key_count, Function&& function)
+{
+    const auto start = std::chrono::steady_clock::now();
+    function();
+    const std::chrono::duration<double, std::nano> duration = std::chrono::steady_clock::now() - start;
+    return key_count == 0 ? 0. : duration.count() / double(key_count);
+}
+
+template <class StringN, class Hash>
+void check_policy(std::string_view policy_name, const std::vector<StringN>& keys)
+{
+    const Hash hash;
+    std::vector<std::size_t> hashes(keys.size());
+    strn::hash_batch(std::span<const StringN>(keys), std::span<std::size_t>(hashes), hash);
+
+    std::cout << "  " << policy_name << std::endl;
+    std::cout << "    " << std::left << std::setw(22) << "table" << std::right << std::setw(10) << "size"
+              << std::setw(10) << "occupied" << std::setw(9) << "/random" << std::setw(12) << "collisions"
+              << std::setw(8) << "chain" << std::setw(10) << "max probe" << std::setw(10) << "mean" << std::endl;
+    const std::size_t power_of_two = std::max<std::size_t>(8, std::bit_ceil(keys.size() * 2));
+    const unsigned shift = 64 - std::countr_zero(power_of_two);
+    print_distribution("2^n, low bits", analyze(hashes, power_of_two, [&](std::size_t h) {
+                           return h & (power_of_two - 1);
+                       }),
+                       keys.size());
+    print_distribution("2^n, high bits", analyze(hashes, power_of_two, [&](std::size_t h) {
+                           return static_cast<std::size_t>(static_cast<uint64_t>(h) >> shift);
+                       }),
+                       keys.size());
+    // The slot index of strn::flat_hash_map: the high bits of the hash, spread first unless Hash declares them mixed.
+    const distribution flat_map_bits = analyze(hashes, power_of_two, [&](std::size_t h) {
+        return static_cast<std::size_t>(strn::spread_high_bits<Hash>(h) >> shift);
+    });
+    print_distribution("strn::flat_hash_map", flat_map_bits, keys.size());
+    const std::size_t prime = next_prime(keys.size() * 2);
+    print_distribution("prime, modulo", analyze(hashes, prime, [&](std::size_t h) { return h % prime; }),
+                       keys.size());
+
+    std::size_t found = 0;
+    std::unordered_map<StringN, uint32_t, Hash> unordered_map;
+    const double unordered_insert = time_per_key_ns(keys.size(), [&] {
+        for (std::size_t i = 0; i < keys.size(); ++i)
+            unordered_map.emplace(keys[i], static_cast<uint32_t>(i));
+    });
+    const double unordered_find = time_per_key_ns(keys.size(), [&] {
+        for (const StringN& key : keys)
+            found += unordered_map.find(key) != unordered_map.end();
+    });
+    std::cout << std::setprecision(1) << "    std::unordered_map: insert " << unordered_insert << " ns, find "
+              << unordered_find << " ns" << std::endl;
+    // The "strn::flat_hash_map" table above is indexed like the map: degenerate probe sequences would make it crawl.
+    if (flat_map_bits.mean_probe_length > max_timed_mean_probe_length)
+    {
+        std::cout << "    strn::flat_hash_map: not timed (mean probe length " << flat_map_bits.mean_probe_length
+                  << ")" << std::endl;
+        return;
+    }
+    strn::flat_hash_map<StringN, uint32_t, Hash> flat_map;
+    const double flat_insert = time_per_key_ns(keys.size(), [&] {
+        for (std::size_t i = 0; i < keys.size(); ++i)
+            flat_map.insert(keys[i], static_cast<uint32_t>(i));
+    });
+    const double flat_find = time_per_key_ns(keys.size(), [&] {
+        for (const StringN& key : keys)
+            found += flat_map.contains(key);
+    });
+    std::cout << "    strn::flat_hash_map: insert " << flat_insert << " ns, find " << flat_find << " ns" << std::endl;
+    if (found != keys.size() * 2)
+        std::cerr << "Lookup mismatch with " << policy_name << std::endl;
+}
+
+template <class StringN>
+void check_type(std::string_view type_name, const char* path)
+{
+    strn::token_reader<StringN> reader(path);
+    std::vector<StringN> keys(reader.begin(), reader.end());
+    const std::size_t token_count = keys.size();
+    std::ranges::sort(keys, {}, [](const StringN& key) { return key.integer(); });
+    const auto duplicates = std::ranges::unique(keys);
+    keys.erase(duplicates.begin(), duplicates.end());
+
+    std::cout << type_name << ": " << token_count << " keys, " << keys.size() << " distinct, "
+              << reader.truncated_count() << " truncated" << std::endl;
+    check_policy<StringN, strn::identity_hash>("identity_hash", keys);
+    check_policy<StringN, strn::fibonacci_hash>("fibonacci_hash", keys);
+    check_policy<StringN, strn::mum_hash>("mum_hash", keys);
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    const std::string_view type = argc == 3 ? std::string_view(argv[2]) : std::string_view("all");
+    if ((argc != 2 && argc != 3) || (type != "all" && type != "32" && type != "56" && type != "64"))
+    {
+        std::cerr << "Usage: " << argv[0] << " <keys.txt> [32|56|64|all]" << std::endl;
+        std::cerr << "The keys are the whitespace-separated tokens of the file." << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    try
+    {
+        if (type == "all" || type == "32")
+            check_type<strn::string32>("string32", argv[1]);
+        if (type == "all" || type == "56")
+            check_type<strn::string56>("string56", argv[1]);
+        if (type == "all" || type == "64")
+            check_type<strn::string64>("string64", argv[1]);
+    }
+    catch (const std::exception& exception)
+    {
+        std::cerr << exception.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,68 @@
+#include <arba/strn/mapped_table.hpp>
+#include <arba/strn/string64.hpp>
+
+#include <charconv>
+#include <cstdlib>
+#include <exception>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <string_view>
+
+// Build a strn::mapped_table<strn::string64, uint64_t> file from a text file of "<key> <value>" lines.
+
+int main(int argc, char** argv)
+{
+    if (argc != 3)
+    {
+        std::cerr << "Usage: " << argv[0] << " <input.txt> <output.strnmt>" << std::endl;
+        std::cerr << "Each input line is a key (8 characters at most) and an unsigned integer value." << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    std::ifstream input(argv[1]);
+    if (!input)
+    {
+        std::cerr << "Cannot open " << argv[1] << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    strn::mapped_table_builder<strn::string64, uint64_t> builder;
+    std::string line;
+    for (std::size_t line_number = 1; std::getline(input, line); ++line_number)
+    {
+        std::string_view line_view(line);
+        if (line_view.empty())
+            continue;
+        const std::size_t key_end = line_view.find_first_of(" \t");
+        const std::size_t value_begin = line_view.find_first_not_of(" \t", key_end);
+        // Trailing blanks (and the '\r' of a CRLF line) are allowed after the value, nothing else.
+        const std::size_t value_end = line_view.find_last_not_of(" \t\r") + 1;
+        uint64_t value = 0;
+        bool valid = key_end != std::string_view::npos && value_begin != std::string_view::npos && key_end <= 8
+                     && value_begin < value_end;
+        if (valid)
+        {
+            const auto [end, error] = std::from_chars(line.data() + value_begin, line.data() + value_end, value);
+            valid = error == std::errc() && end == line.data() + value_end;
+        }
+        if (!valid)
+        {
+            std::cerr << argv[1] << ":" << line_number << ": bad line: " << line << std::endl;
+            return EXIT_FAILURE;
+        }
+        builder.insert_or_assign(strn::string64(line_view.substr(0, key_end)), value);
+    }
+
+    try
+    {
+        builder.write(argv[2]);
+    }
+    catch (const std::exception& exception)
+    {
+        std::cerr << exception.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+    std::cout << "Wrote " << builder.size() << " distinct keys to " << argv[2] << std::endl;
+    return EXIT_SUCCESS;
+}